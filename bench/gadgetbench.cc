@@ -0,0 +1,140 @@
+#include "ecosystem.h"
+#include "maininfo.h"
+#include "stochasticdata.h"
+#include "errorhandler.h"
+#include "gadget.h"
+#include "global.h"
+#include <new>
+
+#ifdef NOT_WINDOWS
+#include <sys/time.h>
+#include <sys/resource.h>
+#endif
+
+/* This program measures how long it takes Gadget to initialise a model and */
+/* then to run the model simulation a number of times, for the model in the  */
+/* current directory.  The command line options are the same as for Gadget,  */
+/* with the extra option -runs <number> for the number of model simulations. */
+/* The heap allocations made by the model simulations are also counted, and  */
+/* the benchmark fails if any are made once the first simulation has run.    */
+
+static long numalloc = 0;
+static int countalloc = 0;
+
+//replace the global operator new so that the heap allocations can be counted
+void* operator new(size_t size) {
+  void* p;
+  if (countalloc)
+    numalloc++;
+  if ((p = malloc(size == 0 ? 1 : size)) == NULL)
+    throw std::bad_alloc();
+  return p;
+}
+
+void* operator new[](size_t size) {
+  return operator new(size);
+}
+
+void operator delete(void* p) {
+  free(p);
+}
+
+void operator delete[](void* p) {
+  free(p);
+}
+
+static double getTime() {
+#ifdef NOT_WINDOWS
+  struct timeval tv;
+  gettimeofday(&tv, NULL);
+  return (double(tv.tv_sec) + double(tv.tv_usec) * 1e-6);
+#else
+  return (double(clock()) / CLOCKS_PER_SEC);
+#endif
+}
+
+//return the peak memory used by this process, in kilobytes
+static long getPeakMemory() {
+#ifdef NOT_WINDOWS
+  struct rusage usage;
+  if (getrusage(RUSAGE_SELF, &usage) != 0)
+    return 0;
+#ifdef __APPLE__
+  return (usage.ru_maxrss / 1024);  //MacOS gives this in bytes
+#else
+  return usage.ru_maxrss;
+#endif
+#else
+  return 0;
+#endif
+}
+
+int main(int aNumber, char* const aVector[]) {
+  MainInfo main;
+  Ecosystem* EcoSystem = 0;
+  StochasticData* data = 0;
+  int i, j, numruns = 10;
+  double starttime, inittime, runtime;
+  char* workingdir;
+
+  //remove the -runs option, so the rest of the options can be read by MainInfo
+  char** options = new char*[aNumber];
+  j = 0;
+  for (i = 0; i < aNumber; i++) {
+    if ((strcasecmp(aVector[i], "-runs") == 0) && (i < aNumber - 1)) {
+      numruns = atoi(aVector[++i]);
+    } else
+      options[j++] = aVector[i];
+  }
+  if (numruns < 1)
+    numruns = 1;
+
+  if ((workingdir = (char*)malloc(LongString)) == NULL)
+    handle.logMessage(LOGFAIL, "Error - failed to malloc space for current working directory");
+  if (getcwd(workingdir, LongString) == NULL)
+    handle.logMessage(LOGFAIL, "Error - failed to get current working directory");
+
+  main.read(j, options);
+  main.checkUsage(workingdir, workingdir);
+
+  //time reading and initialising the model
+  starttime = getTime();
+  EcoSystem = new Ecosystem(main);
+  if (main.getInitialParamGiven()) {
+    data = new StochasticData(main.getInitialParamFile());
+    EcoSystem->Update(data);
+    EcoSystem->checkBounds();
+    delete data;
+  }
+  EcoSystem->Initialise();
+  inittime = getTime() - starttime;
+
+  //then time the model simulations, without printing any model output
+  //the first simulation can set up the storage, so only count allocations after that
+  starttime = getTime();
+  for (i = 0; i < numruns; i++) {
+    EcoSystem->Simulate(0);
+    countalloc = 1;
+  }
+  countalloc = 0;
+  runtime = getTime() - starttime;
+
+  cout << "\nBenchmark results for the model in " << workingdir << endl
+    << "  time to read and initialise (seconds)   " << inittime << endl
+    << "  number of model simulations             " << numruns << endl
+    << "  time for each model simulation (ms)     " << runtime * 1000.0 / numruns << endl
+    << "  model simulations per second            " << (runtime > 0.0 ? numruns / runtime : 0.0) << endl
+    << "  peak memory use (kilobytes)             " << getPeakMemory() << endl
+    << "  heap allocations after first simulation " << numalloc << endl
+    << "  likelihood score                        " << EcoSystem->getLikelihood() << endl << endl;
+
+  delete EcoSystem;
+  delete[] options;
+  free(workingdir);
+  handle.logFinish();
+  if (numalloc > 0) {
+    cerr << "Error in gadgetbench - the model simulations should not allocate any memory\n";
+    return EXIT_FAILURE;
+  }
+  return EXIT_SUCCESS;
+}
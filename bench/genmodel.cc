@@ -0,0 +1,288 @@
+#include "gadget.h"
+
+/* This program writes a complete set of Gadget input files for a synthetic */
+/* model, so that the time taken to run models of different sizes can be   */
+/* measured.  The model has a number of stocks, each with growth, natural   */
+/* mortality and recruitment, that are caught by a number of total fleets.  */
+/* The first stock is a predator of the other stocks.  The likelihood       */
+/* components compare the modelled catch to random length distributions.   */
+
+struct ModelSize {
+  int stocks;
+  int areas;
+  int ages;
+  int lengths;
+  int fleets;
+  int years;
+  int likelihoods;
+  int seed;
+};
+
+static const char* modeldir = ".";
+static ofstream paramfile;
+
+static void openFile(ofstream& outfile, const char* name) {
+  char filename[MaxStrLength];
+  strncpy(filename, "", MaxStrLength);
+  sprintf(filename, "%s/%s", modeldir, name);
+  outfile.open(filename, ios::out);
+  if (outfile.fail()) {
+    cerr << "Error in genmodel - failed to open file " << filename << endl;
+    exit(EXIT_FAILURE);
+  }
+}
+
+//write a parameter to the parameter file, and return the text used to refer to it
+static const char* addParameter(const char* name, double value, double lower, double upper) {
+  static char text[MaxStrLength];
+  paramfile << name << TAB << value << TAB << lower << TAB << upper << TAB << 1 << endl;
+  strncpy(text, "", MaxStrLength);
+  sprintf(text, "#%s", name);
+  return text;
+}
+
+static void showUsage() {
+  cout << "\nUsage: genmodel [options]\n"
+    << " -dir <directory>     write the model files to <directory> (default .)\n"
+    << " -stocks <number>     number of stocks (default 2)\n"
+    << " -areas <number>      number of areas (default 2)\n"
+    << " -ages <number>       number of age groups for each stock (default 8)\n"
+    << " -lengths <number>    number of length groups for each stock (default 40)\n"
+    << " -fleets <number>     number of fleets (default 2)\n"
+    << " -years <number>      number of years, with 4 timesteps each (default 10)\n"
+    << " -likelihoods <number> number of catch distribution components (default 4)\n"
+    << " -seed <number>       seed for the random data (default 1)\n\n";
+  exit(EXIT_FAILURE);
+}
+
+int main(int aNumber, char* const aVector[]) {
+  int i, s, f, a, g, l, y, t, c;
+  double minl, dl, maxl, ml;
+  char name[MaxStrLength];
+  char other[MaxStrLength];
+  strncpy(name, "", MaxStrLength);
+  strncpy(other, "", MaxStrLength);
+  ofstream outfile, datafile;
+  ModelSize size = { 2, 2, 8, 40, 2, 10, 4, 1 };
+
+  for (i = 1; i < aNumber; i++) {
+    if (i == aNumber - 1)
+      showUsage();
+    if (strcasecmp(aVector[i], "-dir") == 0)
+      modeldir = aVector[++i];
+    else if (strcasecmp(aVector[i], "-stocks") == 0)
+      size.stocks = atoi(aVector[++i]);
+    else if (strcasecmp(aVector[i], "-areas") == 0)
+      size.areas = atoi(aVector[++i]);
+    else if (strcasecmp(aVector[i], "-ages") == 0)
+      size.ages = atoi(aVector[++i]);
+    else if (strcasecmp(aVector[i], "-lengths") == 0)
+      size.lengths = atoi(aVector[++i]);
+    else if (strcasecmp(aVector[i], "-fleets") == 0)
+      size.fleets = atoi(aVector[++i]);
+    else if (strcasecmp(aVector[i], "-years") == 0)
+      size.years = atoi(aVector[++i]);
+    else if (strcasecmp(aVector[i], "-likelihoods") == 0)
+      size.likelihoods = atoi(aVector[++i]);
+    else if (strcasecmp(aVector[i], "-seed") == 0)
+      size.seed = atoi(aVector[++i]);
+    else
+      showUsage();
+  }
+  if ((size.stocks < 1) || (size.areas < 1) || (size.ages < 1) || (size.lengths < 1)
+      || (size.fleets < 1) || (size.years < 1) || (size.likelihoods < 0))
+    showUsage();
+
+  srand(size.seed);
+  minl = 5.0;
+  dl = 2.0;
+  maxl = minl + size.lengths * dl;
+  const int firstyear = 1990;
+  const int lastyear = firstyear + size.years - 1;
+
+  openFile(paramfile, "refinputfile");
+  paramfile << "switch\tvalue\tlower\tupper\toptimise\n";
+
+  openFile(outfile, "time");
+  outfile << "firstyear " << firstyear << "\nfirststep 1\nlastyear " << lastyear
+    << "\nlaststep 4\nnotimesteps 4 3 3 3 3\n";
+  outfile.close();
+
+  openFile(outfile, "area");
+  outfile << "areas";
+  for (a = 0; a < size.areas; a++)
+    outfile << sep << a + 1;
+  outfile << "\nsize";
+  for (a = 0; a < size.areas; a++)
+    outfile << sep << 100000;
+  outfile << "\ntemperature\n";
+  for (y = firstyear; y <= lastyear; y++)
+    for (t = 1; t <= 4; t++)
+      for (a = 0; a < size.areas; a++)
+        outfile << y << sep << t << sep << a + 1 << sep << 5 << endl;
+  outfile.close();
+
+  //aggregation files used by the stocks and the likelihood components
+  openFile(outfile, "len.agg");
+  for (l = 0; l < size.lengths; l++)
+    outfile << "len" << l + 1 << sep << minl + l * dl << sep << minl + (l + 1) * dl << endl;
+  outfile.close();
+  openFile(outfile, "allarea.agg");
+  outfile << "allareas";
+  for (a = 0; a < size.areas; a++)
+    outfile << sep << a + 1;
+  outfile << endl;
+  outfile.close();
+  openFile(outfile, "age.agg");
+  for (g = 0; g < size.ages; g++)
+    outfile << "age" << g + 1 << sep << g + 1 << endl;
+  outfile.close();
+  openFile(outfile, "allage.agg");
+  outfile << "allages";
+  for (g = 0; g < size.ages; g++)
+    outfile << sep << g + 1;
+  outfile << endl;
+  outfile.close();
+  openFile(outfile, "refweights");
+  for (l = int(minl) - 1; l < int(maxl) + 3; l++)
+    outfile << l << sep << 1e-5 * l * l * l << endl;
+  outfile.close();
+
+  //the stock files, with the initial population and recruitment data
+  for (s = 0; s < size.stocks; s++) {
+    sprintf(name, "st%d", s);
+    openFile(outfile, name);
+    outfile << "stockname " << name << "\nlivesonareas";
+    for (a = 0; a < size.areas; a++)
+      outfile << sep << a + 1;
+    outfile << "\nminage 1\nmaxage " << size.ages << "\nminlength " << minl
+      << "\nmaxlength " << maxl << "\ndl " << dl
+      << "\nrefweightfile refweights\ngrowthandeatlengths len.agg\ndoesgrow 1"
+      << "\ngrowthfunction lengthvbsimple\ngrowthparameters ";
+    sprintf(other, "%s.linf", name);
+    outfile << addParameter(other, 1.2 * maxl, 0.8 * maxl, 2.0 * maxl) << sep;
+    sprintf(other, "%s.k", name);
+    outfile << addParameter(other, 0.2, 0.05, 0.5) << " 1e-5 3\nbeta ";
+    sprintf(other, "%s.bbeta", name);
+    outfile << addParameter(other, 20, 1, 100) << "\nmaxlengthgroupgrowth "
+      << min(15, size.lengths) << "\nnaturalmortality";
+    for (g = 0; g < size.ages; g++)
+      outfile << " 0.2";
+    outfile << "\niseaten 1\npreylengths len.agg\nenergycontent 1\n";
+
+    if ((s == 0) && (size.stocks > 1)) {
+      outfile << "doeseat 1\nsuitability\n";
+      for (i = 1; i < size.stocks; i++) {
+        sprintf(other, "%s.su.st%d", name, i);
+        outfile << "st" << i << " function newexponentiall50 "
+          << addParameter(other, 0.2, 0.01, 1) << sep << 0.5 * maxl << endl;
+      }
+      outfile << "preference\n";
+      for (i = 1; i < size.stocks; i++)
+        outfile << "st" << i << " 1\n";
+      outfile << "maxconsumption 1e-7 0 0 2\nhalffeedingvalue 0.5\n";
+    } else
+      outfile << "doeseat 0\n";
+
+    outfile << "initialconditions\nminage 1\nmaxage " << size.ages << "\nminlength " << minl
+      << "\nmaxlength " << maxl << "\nnormalparamfile " << name << ".init\n"
+      << "doesmigrate 0\ndoesmature 0\ndoesmove 0\ndoesrenew 1\nminlength " << minl
+      << "\nmaxlength " << maxl << "\nnormalparamfile " << name << ".rec\n"
+      << "doesspawn 0\ndoesstray 0\n";
+    outfile.close();
+
+    sprintf(other, "%s.init", name);
+    openFile(datafile, other);
+    for (a = 0; a < size.areas; a++) {
+      for (g = 0; g < size.ages; g++) {
+        ml = 0.9 * maxl * (1.0 - exp(-0.2 * (g + 1)));
+        datafile << g + 1 << sep << a + 1 << sep << 1000.0 * exp(-0.3 * g) << " 100 "
+          << ml << sep << 0.1 * ml + 1.0 << " 1e-5 3\n";
+      }
+    }
+    datafile.close();
+
+    sprintf(other, "%s.rec", name);
+    openFile(datafile, other);
+    for (y = firstyear; y <= lastyear; y++) {
+      sprintf(other, "%s.rec%d", name, y);
+      strcpy(other, addParameter(other, 1, 0.01, 10));
+      for (a = 0; a < size.areas; a++)
+        datafile << y << " 1 " << a + 1 << " 1 (* 100000 " << other << ") "
+          << minl + 3 * dl << sep << dl << " 1e-5 3\n";
+    }
+    datafile.close();
+  }
+
+  //the fleet file, with the same catch on every timestep
+  openFile(outfile, "fleet");
+  openFile(datafile, "fleet.data");
+  for (f = 0; f < size.fleets; f++) {
+    outfile << "[component]\ntotalfleet fl" << f << "\nlivesonareas";
+    for (a = 0; a < size.areas; a++)
+      outfile << sep << a + 1;
+    outfile << "\nsuitability\n";
+    for (s = 0; s < size.stocks; s++) {
+      outfile << "st" << s << " function exponential ";
+      sprintf(other, "fl%d.a.st%d", f, s);
+      outfile << addParameter(other, -5, -20, 0) << sep;
+      sprintf(other, "fl%d.b.st%d", f, s);
+      outfile << addParameter(other, 0.2, 0.01, 1) << " 0 1\n";
+    }
+    outfile << "amount fleet.data\n";
+    for (y = firstyear; y <= lastyear; y++)
+      for (t = 1; t <= 4; t++)
+        for (a = 0; a < size.areas; a++)
+          datafile << y << sep << t << sep << a + 1 << " fl" << f << sep << 10 * (f + 1) << endl;
+  }
+  outfile.close();
+  datafile.close();
+
+  //the likelihood file, alternating between age-length and length distributions
+  openFile(outfile, "penaltyfile");
+  outfile << "default 2 10000 10000\n";
+  outfile.close();
+  openFile(outfile, "likelihood");
+  outfile << "[component]\nname bounds\nweight 10\ntype penalty\ndatafile penaltyfile\n"
+    << "[component]\nname understocking\nweight 1e-12\ntype understocking\n";
+  for (c = 0; c < size.likelihoods; c++) {
+    f = c % size.fleets;
+    s = (c / size.fleets) % size.stocks;
+    sprintf(name, "ldist%d", c);
+    outfile << "[component]\nname " << name << "\nweight 1\ntype catchdistribution\ndatafile "
+      << name << ".data\n";
+    if (c % 2 == 0)
+      outfile << "function sumofsquares\nareaaggfile allarea.agg\nageaggfile age.agg\n";
+    else
+      outfile << "function multinomial\nepsilon 10\nareaaggfile allarea.agg\nageaggfile allage.agg\n";
+    outfile << "lenaggfile len.agg\nfleetnames fl" << f << "\nstocknames st" << s << endl;
+
+    sprintf(other, "%s.data", name);
+    openFile(datafile, other);
+    for (y = firstyear; y <= lastyear; y++) {
+      if (c % 2 == 0) {
+        for (g = 0; g < size.ages; g++)
+          for (l = 0; l < size.lengths; l++)
+            datafile << y << " 2 allareas age" << g + 1 << " len" << l + 1 << sep << rand() % 51 << endl;
+      } else {
+        for (l = 0; l < size.lengths; l++)
+          datafile << y << " 3 allareas allages len" << l + 1 << sep << rand() % 51 << endl;
+      }
+    }
+    datafile.close();
+  }
+  outfile.close();
+
+  openFile(outfile, "main");
+  outfile << "timefile time\nareafile area\nprintfiles\n[stock]\nstockfiles";
+  for (s = 0; s < size.stocks; s++)
+    outfile << " st" << s;
+  outfile << "\n[tagging]\n[otherfood]\n[fleet]\nfleetfiles fleet\n[likelihood]\nlikelihoodfiles likelihood\n";
+  outfile.close();
+
+  openFile(outfile, "optinfofile");
+  outfile << "[hooke]\nhookeiter 200\n";
+  outfile.close();
+  paramfile.close();
+  return EXIT_SUCCESS;
+}
@@ -3,6 +3,7 @@
 
 #include "conversionindex.h"
 #include "doublematrix.h"
+#include "intvector.h"
 #include "popinfomatrix.h"
 #include "popinfoindexvector.h"
 
@@ -11,13 +12,15 @@ class Maturity;
 /**
  * \class AgeBandMatrix
  * \brief This class implements a vector of PopInfoIndexVector values, indexed from minage not 0
+ *
+ * The PopInfo entries for all the age groups are stored in one contiguous block of memory, with the entries for each age group starting at an offset into that block, so that the entries for the whole population can be accessed without following a pointer for each age group.  Each PopInfoIndexVector returned by this class uses the memory owned by the AgeBandMatrix, and cannot be resized.
  */
 class AgeBandMatrix {
 public:
   /**
    * \brief This is the default AgeBandMatrix constructor
    */
-  AgeBandMatrix() { minage = 0; nrow = 0; v = 0; };
+  AgeBandMatrix() { minage = 0; nrow = 0; v = 0; store = 0; };
   /**
    * \brief This is the AgeBandMatrix constructor for a specified minimum age and size
    * \param age is the minimum index of the vector to be created
@@ -69,25 +72,25 @@ public:
    * \param age is the element of the vector to be returned
    * \return the value of the specified element
    */
-  PopInfoIndexVector& operator [] (int age) { return *(v[age - minage]); };
+  PopInfoIndexVector& operator [] (int age) { return v[age - minage]; };
   /**
    * \brief This will return the value of an element of the vector
    * \param age is the element of the vector to be returned
    * \return the value of the specified element
    */
-  const PopInfoIndexVector& operator [] (int age) const { return *(v[age - minage]); };
+  const PopInfoIndexVector& operator [] (int age) const { return v[age - minage]; };
   /**
    * \brief This will return the minimum length of an age group stored in the vector
    * \param age is identifier for the age group
    * \return minimum length
    */
-  int minLength(int age) const { return v[age - minage]->minCol(); };
+  int minLength(int age) const { return v[age - minage].minCol(); };
   /**
    * \brief This will return the maximum length of an age group stored in the vector
    * \param age is identifier for the age group
    * \return maximum length
    */
-  int maxLength(int age) const { return v[age - minage]->maxCol(); };
+  int maxLength(int age) const { return v[age - minage].maxCol(); };
   /**
    * \brief This function will sum the columns of each element stored in the vector (ie sum over all ages for each length group of the population)
    * \param Result is the PopInfoVector containing the sum over all ages for each length
@@ -160,6 +163,21 @@ public:
    */
   void Add(const AgeBandMatrix& Addition, const ConversionIndex& CI, double ratio = 1.0);
 protected:
+  /**
+   * \brief This function will allocate the memory used to store the population, and set up the entries of the vector to use it
+   * \param minl is the IntVector of minimum lengths used when constructing the entries of the vector
+   * \param size is the IntVector of sizes used when constructing the entries of the vector
+   * \note The entries of the vector are not initialised by this function
+   */
+  void allocate(const IntVector& minl, const IntVector& size);
+  /**
+   * \brief This function will make sure that the temporary storage used by the growth calculations is large enough
+   * \param size is the number of entries required for the growth calculations
+   */
+  void setGrowBuffer(int size) {
+    if (growbuffer.Size() < size)
+      growbuffer.resize(size - growbuffer.Size(), 0.0);
+  };
   /**
    * \brief This is the index for the vector
    */
@@ -171,7 +189,19 @@ protected:
   /**
    * \brief This is the indexed vector of PopInfoIndexVector values
    */
-  PopInfoIndexVector** v;
+  PopInfoIndexVector* v;
+  /**
+   * \brief This is the contiguous block of memory used to store the PopInfo entries for all the age groups
+   */
+  PopInfo* store;
+  /**
+   * \brief This is the IntVector of offsets into the block of memory for the first entry of each age group (with the total number of entries as the last element)
+   */
+  IntVector ageoffset;
+  /**
+   * \brief This is the DoubleVector used as temporary storage by the growth calculations
+   */
+  DoubleVector growbuffer;
 };
 
 #endif
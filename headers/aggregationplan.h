@@ -0,0 +1,103 @@
+#ifndef aggregationplan_h
+#define aggregationplan_h
+
+#include "popinfoindexvector.h"
+#include "conversionindex.h"
+#include "doublevector.h"
+#include "intvector.h"
+
+/**
+ * \class AggregationPlan
+ * \brief This class stores the length group mappings used when aggregating stock information
+ * \note The structure of the aggregation doesn't change during the simulation, so the entries that are to be added together are found once when the aggregator is created, and then the aggregation only needs to add up the stored entries.  The entries are split into groups, where each group is added using the same ratio, and the entries are added in the same order as PopInfoIndexVector::Add would add them.
+ */
+class AggregationPlan {
+public:
+  /**
+   * \brief This is the default AggregationPlan constructor
+   */
+  AggregationPlan() { size = 0; maxsize = 0; dest = 0; source = 0; ratioindex = 0; numpos = 0; };
+  /**
+   * \brief This is the default AggregationPlan destructor
+   */
+  ~AggregationPlan();
+  /**
+   * \brief This will start a new group of entries, which will be added using the same ratio
+   * \return the index of the new group
+   */
+  int addGroup();
+  /**
+   * \brief This will add the entries needed to add a PopInfoIndexVector to another PopInfoIndexVector to the current group
+   * \param Total is the PopInfoIndexVector that the entries will be added to
+   * \param Addition is the PopInfoIndexVector that will be added to Total
+   * \param CI is the ConversionIndex that will convert between the length groups of the 2 vectors
+   * \note This stores the same entries that would be used by PopInfoIndexVector::Add(Addition, CI, ratio)
+   */
+  void addEntries(PopInfoIndexVector& Total, const PopInfoIndexVector& Addition, const ConversionIndex& CI);
+  /**
+   * \brief This will add the entries needed to add a PopInfoIndexVector to another PopInfoIndexVector to the current group, using a vector of multiplicative constants
+   * \param Total is the PopInfoIndexVector that the entries will be added to
+   * \param Addition is the PopInfoIndexVector that will be added to Total
+   * \param CI is the ConversionIndex that will convert between the length groups of the 2 vectors
+   * \param ratiosize is the size of the DoubleVector of multiplicative constants that will be used
+   * \note This stores the same entries that would be used by PopInfoIndexVector::Add(Addition, CI, Ratio, ratio)
+   */
+  void addEntries(PopInfoIndexVector& Total, const PopInfoIndexVector& Addition, const ConversionIndex& CI, int ratiosize);
+  /**
+   * \brief This will add the entries in a group of the plan
+   * \param group is the index of the group to be added
+   * \param ratio is a multiplicative constant applied to each entry
+   */
+  void Sum(int group, double ratio) const;
+  /**
+   * \brief This will add the entries in a group of the plan, using a vector of multiplicative constants
+   * \param group is the index of the group to be added
+   * \param Ratio is a DoubleVector of multiplicative constants to be applied to entries individually
+   * \param ratio is a multiplicative constant applied to each entry
+   */
+  void Sum(int group, const DoubleVector& Ratio, double ratio) const;
+  /**
+   * \brief This will return the number of groups in the plan
+   * \return number of groups
+   */
+  int numGroups() const { return groupstart.Size(); };
+private:
+  /**
+   * \brief This function will add one entry to the current group
+   * \param d is the PopInfo that the entry will be added to
+   * \param s is the PopInfo that will be added
+   * \param r is the index of the multiplicative constant for the entry
+   * \param n is the number that the total should be divided by after the entry has been added
+   */
+  void addEntry(PopInfo* d, const PopInfo* s, int r, int n);
+  /**
+   * \brief This is the IntVector of the index of the first entry in each group
+   */
+  IntVector groupstart;
+  /**
+   * \brief This is the number of entries in the plan
+   */
+  int size;
+  /**
+   * \brief This is the number of entries that memory has been allocated for
+   */
+  int maxsize;
+  /**
+   * \brief This is the array of the PopInfo values that each entry will be added to
+   */
+  PopInfo** dest;
+  /**
+   * \brief This is the array of the PopInfo values that will be added for each entry
+   */
+  const PopInfo** source;
+  /**
+   * \brief This is the array of the index of the multiplicative constant for each entry
+   */
+  int* ratioindex;
+  /**
+   * \brief This is the array of the number that the total is divided by after each entry has been added
+   */
+  int* numpos;
+};
+
+#endif
@@ -185,6 +185,11 @@ public:
    * \return number of substeps
    */
   int numSubSteps() const { return numsubsteps[currentstep - 1]; };
+  /**
+   * \brief This will return the largest number of substeps in any timestep of the model simulation
+   * \return maximum number of substeps
+   */
+  int maxSubSteps() const;
   /**
    * \brief This is the function that increases the substep within the current timestep
    */
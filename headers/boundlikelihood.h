@@ -54,6 +54,11 @@ public:
    * \note keeper can adjust the value of the parameters to ensure that they are within the bounds
    */
   virtual void addLikelihoodKeeper(const TimeClass* const TimeInfo, Keeper* const keeper);
+  /**
+   * \brief This will return whether the likelihood score can only increase during a model simulation
+   * \return 1 if none of the weights for the bounds are negative, 0 otherwise
+   */
+  virtual int isIncreasing() const;
   /**
    * \brief This function will print the summary MigrationPenalty likelihood information
    * \param outfile is the ofstream that all the model information gets sent to
@@ -38,6 +38,12 @@ public:
    * \param TimeInfo is the TimeClass for the current model
    */
   virtual void addLikelihood(const TimeClass* const TimeInfo);
+  /**
+   * \brief This will return whether the likelihood score can only increase during a model simulation
+   * \return 1 for the pearson, sumofsquares, log and stratified likelihood functions, 0 otherwise
+   * \note The multinomial, gamma, mvn and mvlogistic likelihood functions include terms that can be negative
+   */
+  virtual int isIncreasing() const { return ((functionnumber == 2) || (functionnumber == 4) || (functionnumber == 7) || (functionnumber == 8)); };
   /**
    * \brief This function will reset the CatchDistribution likelihood information
    * \param keeper is the Keeper for the current model
@@ -76,6 +82,13 @@ private:
    */
   void readDistributionData(CommentStream& infile, const TimeClass* TimeInfo,
     int numarea, int numage, int numlen);
+  /**
+   * \brief This function will calculate the terms of the multinomial function that only depend on the observed data
+   * \param numarea is the number of areas that the likelihood data covers
+   * \param numage is the number of age groups that the likelihood data covers
+   * \param numlen is the number of length groups that the likelihood data covers
+   */
+  void calcDataTerms(int numarea, int numage, int numlen);
   /**
    * \brief This function will calculate the likelihood score for the current timestep based on a multinomial function
    * \return likelihood score
@@ -253,6 +266,19 @@ private:
    * \note This is set to zero, and not used, if the multinomial function is not used
    */
   Multinomial MN;
+  /**
+   * \brief This is the DoubleVector used to store the modelled age distribution for one length group, if the multinomial function has been selected
+   */
+  DoubleVector agedist;
+  /**
+   * \brief This is the DoubleVector used to store the observed age distribution for one length group, if the multinomial function has been selected
+   */
+  DoubleVector agedata;
+  /**
+   * \brief This is the DoubleMatrix used to store the terms of the multinomial function that only depend on the observed data, if the multinomial function has been selected
+   * \note The indices for this object are [time][area] if there is only one age group, and [time][area * number of length groups + length] otherwise
+   */
+  DoubleMatrix dataterms;
   /**
    * \brief This is the AgeBandMatrixPtrVector used to temporarily store the information returned from the aggregatation function
    * \note The indices for this object are [area][age][length]
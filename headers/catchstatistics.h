@@ -36,6 +36,11 @@ public:
    * \param TimeInfo is the TimeClass for the current model
    */
   virtual void addLikelihood(const TimeClass* const TimeInfo);
+  /**
+   * \brief This will return whether the likelihood score can only increase during a model simulation
+   * \return 1, since the score is a weighted sum of squares
+   */
+  virtual int isIncreasing() const { return 1; };
   /**
    * \brief This function will reset the CatchStatistics likelihood information
    * \param keeper is the Keeper for the current model
@@ -7,13 +7,15 @@
 /**
  * \class DoubleMatrix
  * \brief This class implements a dynamic vector of DoubleVector values
+ *
+ * The entries of the rows that are created together (by the constructor or by the first call to AddRows) are stored in one contiguous block of memory, with each DoubleVector using part of that block.  Rows that are added later, or that are resized, use their own memory so that the rows do not need to be the same length.
  */
 class DoubleMatrix {
 public:
   /**
    * \brief This is the default DoubleMatrix constructor
    */
-  DoubleMatrix() { nrow = 0; v = 0; };
+  DoubleMatrix() { nrow = 0; v = 0; store = 0; };
   /**
    * \brief This is the DoubleMatrix constructor for a specified size
    * \param nr is the size of the vector to be created
@@ -88,6 +90,16 @@ public:
    */
   DoubleMatrix& operator = (const DoubleMatrix& d);
 protected:
+  /**
+   * \brief This function will create the rows of the vector, using one contiguous block of memory for all the entries
+   * \param size is the IntVector of the sizes of the rows to be created
+   * \note The entries of the vector are not initialised by this function
+   */
+  void allocate(const IntVector& size);
+  /**
+   * \brief This function will free all the memory used by the vector
+   */
+  void freeStore();
   /**
    * \brief This is number of rows of the vector
    */
@@ -96,6 +108,10 @@ protected:
    * \brief This is the vector of DoubleVector values
    */
   DoubleVector** v;
+  /**
+   * \brief This is the contiguous block of memory used to store the entries of the rows
+   */
+  double* store;
 };
 
 #endif
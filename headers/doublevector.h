@@ -13,7 +13,7 @@ public:
   /**
    * \brief This is the default DoubleVector constructor
    */
-  DoubleVector() { size = 0; v = 0; };
+  DoubleVector() { size = 0; v = 0; owner = 1; };
   /**
    * \brief This is the DoubleVector constructor for a specified size
    * \param sz is the size of the vector to be created
@@ -31,6 +31,13 @@ public:
    * \param initial is the DoubleVector to copy
    */
   DoubleVector(const DoubleVector& initial);
+  /**
+   * \brief This is the DoubleVector constructor for a vector that uses memory that has been allocated elsewhere
+   * \param sz is the size of the vector to be created
+   * \param store is the pointer to the first of the sz entries that the vector will use
+   * \note The memory is not owned by the vector, so it will not be freed by the destructor
+   */
+  DoubleVector(int sz, double* store);
   /**
    * \brief This is the DoubleVector destructor
    * \note This will free all the memory allocated to all the elements of the vector
@@ -85,6 +92,13 @@ public:
    * \param d is the DoubleVector to copy
    */
   DoubleVector& operator = (const DoubleVector& d);
+  /**
+   * \brief This will set the vector to use memory that has been allocated elsewhere
+   * \param sz is the size of the vector
+   * \param store is the pointer to the first of the sz entries that the vector will use
+   * \note Any change to the size of the vector will move the entries into memory owned by the vector
+   */
+  void setStore(int sz, double* store);
 protected:
   /**
    * \brief This is the vector of double values
@@ -94,6 +108,10 @@ protected:
    * \brief This is the size of the vector
    */
   int size;
+  /**
+   * \brief This is the flag used to denote whether the vector owns the memory used to store the entries
+   */
+  int owner;
 };
 
 #endif
@@ -12,6 +12,7 @@
 #include "printerptrvector.h"
 #include "likelihoodptrvector.h"
 #include "optinfoptrvector.h"
+#include "ecosystemptrvector.h"
 #include "stock.h"
 #include "fleet.h"
 #include "otherfood.h"
@@ -19,8 +20,19 @@
 #include "maininfo.h"
 #include "printinfo.h"
 #include "optinfo.h"
+#include "profiler.h"
+#include "threadpool.h"
+#include "evaluationcache.h"
+#include "intmatrix.h"
 #include "gadget.h"
 
+/**
+ * \brief This is the enumerated list of the phases of the model simulation that are timed when the simulation is being profiled
+ * \note The time spent in each predation substep is recorded from PROFPREDATION onwards
+ */
+enum ProfilePhase { PROFSIMULATE = 0, PROFRESET, PROFPRINT, PROFMIGRATE, PROFPOPULATION,
+  PROFLIKELIHOOD, PROFAGE, PROFPREDATION };
+
 /**
  * \class Ecosystem
  * \brief This is the class used to control the model simulation
@@ -36,8 +48,9 @@ public:
   /**
    * \brief This is the Ecosystem constructor specifying details about the model
    * \param main is the MainInfo specifying the command line options for the model run
+   * \param worker is the flag to denote whether this is a copy of the model used to evaluate points for an optimisation algorithm (default value 0)
    */
-  Ecosystem(const MainInfo& main);
+  Ecosystem(const MainInfo& main, int worker = 0);
   /**
    * \brief This is the default Ecosystem destructor
    */
@@ -111,6 +124,11 @@ public:
    * \brief This function will display information about the optimised values of the parameters
    */
   void writeOptValues();
+  /**
+   * \brief This function will write information about the time spent in each part of the model simulation to the log file and to file
+   * \param filename is the name of the file to write the information to
+   */
+  void writeProfile(const char* const filename);
   /**
    * \brief This is the function that will optimise the likelihood score
    */
@@ -200,13 +218,64 @@ public:
    * \note This function covers the increase in age and the simple 'doesmove' option for movement between stocks
    */
   void updateAgesOneArea(int area = 0);
+  /**
+   * \brief This function will update the population numbers of one group of stocks on an area
+   * \param area is the area to update the population on
+   * \param group is the index of the group of stocks
+   */
+  void updatePopulationGroup(int area, int group);
+  /**
+   * \brief This function will update the ages of the population of one group of stocks on an area
+   * \param area is the area to update the population on
+   * \param group is the index of the group of stocks
+   */
+  void updateAgesGroup(int area, int group);
   /**
    * \brief This function will update the model parameters, run the model and calculate a likelihood score
    * \param x is the DoubleVector containing the updated values for the parameters
    * \return likelihood score
-   * \note This function gets updated values for the model parameters from the optimisation algorithm and performs a model run based on these new values, calculating a new likelihood score that is then returned to the optimisation algorithm
+   * \note This function gets updated values for the model parameters from the optimisation algorithm and performs a model run based on these new values, calculating a new likelihood score that is then returned to the optimisation algorithm.  If the likelihood score for these values is stored in the EvaluationCache then the model isnt run again
    */
   double SimulateAndUpdate(const DoubleVector& x);
+  /**
+   * \brief This function will update the model parameters, run the model and calculate a likelihood score, stopping the model run early if the likelihood score is worse than a given score
+   * \param x is the DoubleVector containing the updated values for the parameters
+   * \param cutoff is the likelihood score that the model run is stopped at
+   * \return likelihood score, or a lower bound for the likelihood score if the model run has been stopped early
+   * \note The model run is only stopped early if none of the likelihood components can decrease, and if no snapshots of the model or -o output are being taken.  isStoppedEarly() will return 1 if the model run has been stopped early
+   */
+  double SimulateAndUpdate(const DoubleVector& x, double cutoff);
+  /**
+   * \brief This function will return whether the last model run was stopped early
+   * \return 1 if the model run was stopped because the likelihood score was worse than the cutoff, 0 otherwise
+   */
+  int isStoppedEarly() const { return simstopped; };
+  /**
+   * \brief This function will run the model again for the parameters from the last model run, if that model run was stopped early
+   * \return likelihood score
+   * \note This doesnt count as a new function evaluation, since it completes the calculation of the likelihood score for the last point
+   */
+  double finishSimulation();
+  /**
+   * \brief This function will run the model and calculate a likelihood score for a batch of points
+   * \param x is the DoubleMatrix containing the updated values for the parameters, with one point on each row
+   * \param f is the DoubleVector that will contain the likelihood score for each point
+   * \note The points are sent to the worker processes if these have been started, otherwise they are shared between this model and the worker copies of the model, which are run at the same time if Gadget has been compiled with thread support.  The function evaluation counter and the -o output are then updated in the order that the points are given, so the results are the same as calling SimulateAndUpdate for each point in turn.  The points that are stored in the EvaluationCache arent run again, and the likelihood scores for the other points are stored once they have been run
+   */
+  void SimulateAndUpdate(const DoubleMatrix& x, DoubleVector& f);
+  /**
+   * \brief This function will run the model for the requests that are received on a local socket, for a network run
+   * \param filename is the name of the socket
+   * \note Gadget will wait for one connection to the socket, and then run the model for each request that is received until the connection is closed
+   */
+  void serveSocket(const char* const filename);
+  /**
+   * \brief This function will run the model for each of the remaining lines in a parameter file that contains repeated values
+   * \param data is the StochasticData containing the parameter values to be used
+   * \param print is the flag to denote whether the model output should be printed or not
+   * \note The lines are shared between the worker copies of the model (or the worker processes) in batches, and the output is then written in the order of the lines in the file.  If the model output is to be printed then each line is run by this model in turn
+   */
+  void SimulateRepeatedValues(StochasticData* const data, int print);
   /**
    * \brief This function will return the likelihood score from the current simulation
    * \return likelihood score
@@ -217,6 +286,11 @@ public:
    * \return number of iterations
    */
   int getFuncEval() const { return funceval; };
+  /**
+   * \brief This function will return the number of worker processes that will be used to evaluate the model
+   * \return number of worker processes
+   */
+  int getNumForks() const { return numforks; };
   /**
    * \brief This function will return the current time in the simulation
    * \return current time
@@ -262,6 +336,144 @@ public:
    */
   volatile int interrupted;
 protected:
+  /**
+   * \brief This function will convert the scaled values from the optimisation algorithm to the values of all the parameters
+   * \param x is the DoubleVector containing the scaled values for the parameters to be optimised
+   * \param val is the DoubleVector that will contain the values of all the parameters
+   */
+  void convertScaledValues(const DoubleVector& x, DoubleVector& val);
+  /**
+   * \brief This function will run the model for the points in the current batch that have been given to this model
+   */
+  void simulateBatch();
+  /**
+   * \brief This function will set up the list of the parts of the model simulation that are timed when the simulation is being profiled
+   */
+  void initialiseProfile();
+  /**
+   * \brief This is the function used as the entry point for the threads that run the worker copies of the model
+   * \param eco is the Ecosystem that will run the points in the current batch that have been given to it
+   */
+  static void* runBatch(void* eco);
+  /**
+   * \brief This is the function used to calculate the likelihood score for one likelihood component as a task in the ThreadPool
+   * \param eco is the Ecosystem that contains the likelihood component
+   * \param comp is the index of the likelihood component
+   */
+  static void runLikelihood(void* eco, int comp);
+  /**
+   * \brief This is the function used to calculate the predation on one area as a task in the ThreadPool
+   * \param eco is the Ecosystem that contains the area
+   * \param area is the index of the area
+   */
+  static void runPredationArea(void* eco, int area);
+  /**
+   * \brief This is the function used to update the population numbers of one group of stocks as a task in the ThreadPool
+   * \param eco is the Ecosystem that contains the stocks
+   * \param group is the index of the group of stocks
+   * \note The stocks are updated on the area given by stockarea
+   */
+  static void runPopulationGroup(void* eco, int group);
+  /**
+   * \brief This is the function used to update the ages of one group of stocks as a task in the ThreadPool
+   * \param eco is the Ecosystem that contains the stocks
+   * \param group is the index of the group of stocks
+   * \note The stocks are updated on the area given by stockarea
+   */
+  static void runAgesGroup(void* eco, int group);
+  /**
+   * \brief This function will check whether the current model run can be stopped early
+   * \return 1 if the likelihood score so far is worse than the cutoff, 0 otherwise
+   */
+  int isOverCutoff() const;
+  /**
+   * \brief This function will split the stocks into the groups of stocks that move fish between each other
+   * \note The links between the stocks come from maturation, transition, spawning and straying, and all the tagged stocks are kept in one group since they share the tagging experiments
+   */
+  void setStockGroups();
+  /**
+   * \brief This function will join the groups of a stock and the stocks that it is linked to
+   * \param group is the IntVector of the group that each stock belongs to
+   * \param stock is the index of the stock
+   * \param linked is the StockPtrVector of the stocks that the stock is linked to
+   */
+  void joinStockGroups(IntVector& group, int stock, const StockPtrVector& linked);
+  /**
+   * \brief This function will start the worker processes used to evaluate the model
+   * \note The worker processes are copies of this model, created by fork() once the model has been initialised, that communicate with this model through a socket
+   */
+  void startFarm();
+  /**
+   * \brief This function will stop the worker processes used to evaluate the model
+   */
+  void stopFarm();
+  /**
+   * \brief This function will run the model for a batch of points using the worker processes
+   * \param points is the DoubleMatrix containing the values of all the parameters, with one point on each row
+   * \param f is the DoubleVector that will contain the likelihood score for each point
+   * \param likes is the DoubleMatrix that will contain the unweighted likelihood scores for each point
+   * \param values is the DoubleMatrix that will contain the values of all the parameters at the end of the model run for each point
+   */
+  void simulateFarm(const DoubleMatrix& points, DoubleVector& f, DoubleMatrix& likes, DoubleMatrix& values);
+  /**
+   * \brief This function will run the model for a batch of points, using the worker processes or the worker copies of the model if these are available
+   * \param points is the DoubleMatrix containing the values of all the parameters, with one point on each row
+   * \param f is the DoubleVector that will contain the likelihood score for each point
+   * \param likes is the DoubleMatrix that will contain the unweighted likelihood scores for each point
+   * \param values is the DoubleMatrix that will contain the values of all the parameters at the end of the model run for each point
+   */
+  void simulatePoints(const DoubleMatrix& points, DoubleVector& f, DoubleMatrix& likes, DoubleMatrix& values);
+  /**
+   * \brief This function will run the model for each request that is received on a connection, until the connection is closed
+   * \param fd is the file descriptor of the connection
+   */
+  void serveRequests(int fd);
+  /**
+   * \brief This function will choose the timesteps that snapshots of the model will be taken on
+   * \note The snapshots are shared between the timesteps that the parameters to be optimised are first used on, so that a change to any of these parameters can be simulated from a snapshot that is close to that timestep
+   */
+  void chooseCheckpoints();
+  /**
+   * \brief This function will start recording the timesteps that the parameters are used on, and taking snapshots of the model, for the current model run
+   */
+  void startTrace();
+  /**
+   * \brief This function will stop recording the timesteps that the parameters are used on
+   */
+  void stopTrace();
+  /**
+   * \brief This function will record the start of a timestep, and take a snapshot of the model if this is one of the chosen timesteps
+   * \param step is the timestep that is about to be simulated
+   * \note The snapshot is a copy of this model, created by fork(), that waits for requests to resume the simulation from this timestep
+   */
+  void checkpointStep(int step);
+  /**
+   * \brief This function will resume the simulation from the snapshot for each request that is received on a connection, until the connection is closed
+   * \param fd is the file descriptor of the connection
+   * \note The simulation is resumed in a copy of the snapshot, created by fork(), and this function only returns in that copy
+   */
+  void holdCheckpoint(int fd);
+  /**
+   * \brief This function will send the likelihood score from a simulation that has been resumed from a snapshot, and then exit
+   */
+  void finishResume();
+  /**
+   * \brief This function will run the model from the latest snapshot that can be used for the new values of the parameters
+   * \param val is the DoubleVector containing the values of all the parameters
+   * \return 1 if the simulation was resumed from a snapshot, 0 if the model needs to be run from the start
+   */
+  int resumeSimulation(const DoubleVector& val);
+  /**
+   * \brief This function will keep the snapshots that have been taken during the last model run
+   * \param val is the DoubleVector containing the values of all the parameters for the last model run
+   * \note The snapshots from the last model run and the model run with the best likelihood score are kept
+   */
+  void updateCheckpoints(const DoubleVector& val);
+  /**
+   * \brief This function will stop the processes that keep the snapshots of the model
+   * \param gen is the model run that the snapshots to be stopped were taken from (default value -1, to stop all the snapshots)
+   */
+  void stopCheckpoints(int gen = -1);
   /**
    * \brief This is the value of the likelihood score for the current simulation
    */
@@ -337,6 +549,170 @@ protected:
    * \note This vector is only used to temporarily store values during an optimising run
    */
   IntVector optflag;
+  /**
+   * \brief This is the EcosystemPtrVector of the worker copies of the model used to evaluate points at the same time
+   */
+  EcosystemPtrVector workers;
+  /**
+   * \brief This is the flag used to denote whether this is a worker copy of the model
+   */
+  int isworker;
+  /**
+   * \brief This is the ErrorHandler for this model
+   * \note The worker copies of the model have their own ErrorHandler, while the main model uses the global ErrorHandler
+   */
+  ErrorHandler* errorhandler;
+  /**
+   * \brief This is the DoubleMatrix of the values of all the parameters for the current batch of points
+   */
+  const DoubleMatrix* batchpoints;
+  /**
+   * \brief This is the DoubleMatrix that will contain the unweighted likelihood components for each point in the current batch
+   */
+  DoubleMatrix* batchlikes;
+  /**
+   * \brief This is the DoubleMatrix that will contain the values of all the parameters at the end of the model run for each point in the current batch
+   * \note These values can be different to the values in batchpoints, since the bound likelihood component can change the values
+   */
+  DoubleMatrix* batchvalues;
+  /**
+   * \brief This is the DoubleVector that will contain the likelihood score for each point in the current batch
+   */
+  DoubleVector* batchscores;
+  /**
+   * \brief This is the first point in the current batch that has been given to this model
+   */
+  int batchstart;
+  /**
+   * \brief This is the interval between the points in the current batch that have been given to this model
+   */
+  int batchstep;
+  /**
+   * \brief This is the number of worker processes that will be used to evaluate the model
+   */
+  int numforks;
+  /**
+   * \brief This is the IntVector of the file descriptors of the connections to the worker processes
+   */
+  IntVector farmfd;
+  /**
+   * \brief This is the IntVector of the process identifiers of the worker processes
+   */
+  IntVector farmpid;
+  /**
+   * \brief This is the number of snapshots of the model that will be taken on each model run
+   */
+  int numcheckpoints;
+  /**
+   * \brief This is the flag used to denote whether snapshots of the model will be taken on the current model run
+   */
+  int checkcapture;
+  /**
+   * \brief This is the flag used to denote whether the last model run was resumed from a snapshot
+   */
+  int checkresumed;
+  /**
+   * \brief This is the file descriptor that the likelihood score is sent to when the simulation has been resumed from a snapshot
+   * \note This is -1 unless this is a copy of a snapshot that is resuming the simulation
+   */
+  int checkreply;
+  /**
+   * \brief This is the identifier of the request to resume the simulation from a snapshot
+   */
+  int checkid;
+  /**
+   * \brief This is the IntVector of the timesteps that snapshots of the model will be taken on
+   */
+  IntVector checksteps;
+  /**
+   * \brief This is the IntVector of the file descriptors of the connections to the snapshots
+   */
+  IntVector checkfd;
+  /**
+   * \brief This is the IntVector of the process identifiers of the snapshots
+   */
+  IntVector checkpid;
+  /**
+   * \brief This is the IntVector of the timestep that each snapshot was taken on
+   */
+  IntVector checkstep;
+  /**
+   * \brief This is the IntVector of the model run that each snapshot was taken from
+   */
+  IntVector checkgen;
+  /**
+   * \brief This is the DoubleMatrix of the values of all the parameters for each model run that snapshots were taken from
+   */
+  DoubleMatrix checkvalues;
+  /**
+   * \brief This is the DoubleVector of the likelihood score for each model run that snapshots were taken from
+   */
+  DoubleVector checkscore;
+  /**
+   * \brief This is the DoubleVector of the values of all the parameters from the last simulation resumed from a snapshot
+   */
+  DoubleVector checkval;
+  /**
+   * \brief This is the DoubleVector of the unweighted likelihood components from the last simulation resumed from a snapshot
+   */
+  DoubleVector checklikes;
+  /**
+   * \brief This is the Profiler used to record the time spent in each part of the model simulation
+   */
+  Profiler profile;
+  /**
+   * \brief This is the index of the first stock, fleet or otherfood class in the list of entries that are timed
+   */
+  int profbase;
+  /**
+   * \brief This is the index of the first likelihood component in the list of entries that are timed
+   */
+  int proflike;
+  /**
+   * \brief This is the ThreadPool used to run parts of each model simulation at the same time
+   */
+  ThreadPool simpool;
+  /**
+   * \brief This is the flag used to denote whether the likelihood components can be calculated at the same time
+   * \note The likelihood components only read the model population and update their own scores, so they can be calculated at the same time, except for any proglikelihood components which are always calculated in turn
+   */
+  int likeconcurrent;
+  /**
+   * \brief This is the flag used to denote whether the predation on each area can be calculated at the same time
+   * \note The predation on an area only uses the part of the population on that area, so the areas can be calculated at the same time unless the model contains tagging experiments or quota fleets, which share information between the areas
+   */
+  int areaconcurrent;
+  /**
+   * \brief This is the flag used to denote whether the current model run can be stopped early
+   */
+  int usecutoff;
+  /**
+   * \brief This is the likelihood score that the current model run will be stopped at
+   */
+  double simcutoff;
+  /**
+   * \brief This is the flag used to denote whether the last model run was stopped early
+   * \note The model population is only partly updated if this is set, so the model needs to be run again before the model population can be used
+   */
+  int simstopped;
+  /**
+   * \brief This is the IntMatrix of the index of the stocks in each group of stocks that move fish between each other
+   * \note The stocks in one group are updated in turn, while the groups dont share any fish so they can be updated at the same time.  The indices for this object are [group][stock]
+   */
+  IntMatrix stockgroups;
+  /**
+   * \brief This is the area that the groups of stocks are being updated on by the ThreadPool
+   */
+  int stockarea;
+  /**
+   * \brief This is the EvaluationCache used to store the likelihood scores for the points that have already been evaluated
+   */
+  EvaluationCache evalcache;
+  /**
+   * \brief This is the flag used to denote whether the likelihood score for the last point was found in the EvaluationCache
+   * \note The model hasnt been run for the last point if this is set, so the model needs to be run again before the model population can be used
+   */
+  int cachehit;
 };
 
 #endif
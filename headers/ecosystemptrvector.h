@@ -0,0 +1,65 @@
+#ifndef ecosystemptrvector_h
+#define ecosystemptrvector_h
+
+class Ecosystem;
+
+/**
+ * \class EcosystemPtrVector
+ * \brief This class implements a dynamic vector of Ecosystem values
+ */
+class EcosystemPtrVector {
+public:
+  /**
+   * \brief This is the default EcosystemPtrVector constructor
+   */
+  EcosystemPtrVector() { size = 0; v = 0; };
+  /**
+   * \brief This is the EcosystemPtrVector constructor that creates a copy of an existing EcosystemPtrVector
+   * \param initial is the EcosystemPtrVector to copy
+   */
+  EcosystemPtrVector(const EcosystemPtrVector& initial);
+  /**
+   * \brief This is the EcosystemPtrVector destructor
+   * \note This will free all the memory allocated to all the elements of the vector
+   */
+  ~EcosystemPtrVector();
+  /**
+   * \brief This will add one new entry to the vector
+   * \param value is the value that will be entered for the new entry
+   */
+  void resize(Ecosystem* value);
+  /**
+   * \brief This will delete an entry from the vector
+   * \param pos is the element of the vector to be deleted
+   * \note This will free the memory allocated to the deleted element of the vector
+   */
+  void Delete(int pos);
+  /**
+   * \brief This will return the size of the vector
+   * \return the size of the vector
+   */
+  int Size() const { return size; };
+  /**
+   * \brief This will return the value of an element of the vector
+   * \param pos is the element of the vector to be returned
+   * \return the value of the specified element
+   */
+  Ecosystem*& operator [] (int pos) { return v[pos]; };
+  /**
+   * \brief This will return the value of an element of the vector
+   * \param pos is the element of the vector to be returned
+   * \return the value of the specified element
+   */
+  Ecosystem* const& operator [] (int pos) const { return v[pos]; };
+protected:
+  /**
+   * \brief This is the vector of Ecosystem values
+   */
+  Ecosystem** v;
+  /**
+   * \brief This is the size of the vector
+   */
+  int size;
+};
+
+#endif
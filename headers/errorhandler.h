@@ -10,6 +10,7 @@ enum LogLevel { LOGNONE = 0, LOGFAIL, LOGINFO, LOGWARN, LOGDEBUG, LOGMESSAGE, LO
 /**
  * \class ErrorHandler
  * \brief This is the class used to handle errors in the model, by displaying error messages to the user and logging information to a log file
+ * \note Each copy of the model has its own ErrorHandler.  The messages sent to the global ErrorHandler are passed on to the ErrorHandler that has been set for the model that is being run on the current thread, so each copy of the model keeps its own logging level, list of open files and count of warnings
  */
 class ErrorHandler {
 public:
@@ -45,7 +46,7 @@ public:
    * \brief This function will return the flag used to determine whether ta logfile exists
    * \return uselog
    */
-  int checkLogFile() { return uselog; };
+  int checkLogFile() const { return this->getHandler()->uselog; };
   /**
    * \brief This function will log information about the finish of the current model run to std::cout and a log file if one exists
    */
@@ -103,6 +104,7 @@ public:
    * \brief This function will log a warning message about a NaN found in the model
    * \param mlevel is the logging level of the message to be logged
    * \param msg is the message to be logged
+   * \note The model component that found the NaN is responsible for recording it, so that the NaN is only seen by the copy of the model that found it
    */
   void logMessageNaN(LogLevel mlevel, const char* msg);
   /**
@@ -148,12 +150,12 @@ public:
    * \brief This function will set the optimise flag for the current model run
    * \param opt is the optimise flag to be set
    */
-  void setRunOptimise(int opt) { runopt = opt; };
+  void setRunOptimise(int opt) { this->getHandler()->runopt = opt; };
   /**
    * \brief This function will return the optimise flag for the current model run
    * \return runopt
    */
-  int getRunOptimise() const { return runopt; };
+  int getRunOptimise() const { return this->getHandler()->runopt; };
   /**
    * \brief This function will set the level of logging information used for the current model run
    * \param level is the logging level to be set
@@ -163,16 +165,17 @@ public:
    * \brief This function will return the level of logging information used for the current model run
    * \return loglevel
    */
-  LogLevel getLogLevel() const { return loglevel; };
+  LogLevel getLogLevel() const { return this->getHandler()->loglevel; };
   /**
-   * \brief This function will return the flag denoting whether a NaN error has been rasied or not
-   * \return nanflag
+   * \brief This function will set the ErrorHandler for the model that is being run on the current thread
+   * \param eh is the ErrorHandler for the model (or 0 to use the global ErrorHandler)
    */
-  int getNaNFlag() const { return nanflag; };
+  static void setActive(ErrorHandler* eh);
   /**
-   * \brief This function will return the flag denoting whether a NaN error has been rasied or not
+   * \brief This function will return the ErrorHandler for the model that is being run on the current thread
+   * \return ErrorHandler for the model, or 0 if the global ErrorHandler is used
    */
-  void setNaNFlag(int flag) { nanflag = flag; };
+  static ErrorHandler* getActive();
 protected:
   /**
    * \brief This ofstream is the file that all the logging information will get sent to
@@ -184,9 +187,23 @@ protected:
   StrStack* files;
 private:
   /**
-   * \brief This is the flag used to denote whether a NaN error has been raised or nont
+   * \brief This function will return the ErrorHandler that the messages for the current thread should be sent to
+   * \return ErrorHandler for the model that is being run on the current thread, or this ErrorHandler if none has been set
    */
-  int nanflag;
+  ErrorHandler* getHandler();
+  /**
+   * \brief This function will return the ErrorHandler that the messages for the current thread should be sent to
+   * \return ErrorHandler for the model that is being run on the current thread, or this ErrorHandler if none has been set
+   */
+  const ErrorHandler* getHandler() const;
+  /**
+   * \brief This function will lock the log output so that messages from different threads are not mixed up
+   */
+  void lockLog();
+  /**
+   * \brief This function will unlock the log output once a message has been written
+   */
+  void unlockLog();
   /**
    * \brief This is the flag used to denote whether the current run will optimise the model or not
    */
@@ -203,6 +220,12 @@ private:
    * \brief This denotes what level of logging information is used for the current model run
    */
   LogLevel loglevel;
+#ifdef GADGET_THREADS
+  /**
+   * \brief This is the mutex used to make sure that only one thread writes a message at a time
+   */
+  pthread_mutex_t logmutex;
+#endif
 };
 
 #endif
@@ -0,0 +1,136 @@
+#ifndef evaluationcache_h
+#define evaluationcache_h
+
+#include "likelihoodptrvector.h"
+#include "keeper.h"
+#include "doublematrix.h"
+#include "doublevector.h"
+#include "intvector.h"
+
+/**
+ * \class EvaluationCache
+ * \brief This is the class used to store the likelihood scores for the points that have already been evaluated during an optimising run
+ * \note The optimisation algorithms often ask for the likelihood score of a point that has already been evaluated (for example the best point at the end of an optimisation algorithm, or the starting point of the next optimisation algorithm), so the likelihood score and the unweighted likelihood scores from each likelihood component are stored for the most recent points.  A point is only found if all the parameter values are exactly the same, and once the cache is full the point that was used least recently is replaced.
+ */
+class EvaluationCache {
+public:
+  /**
+   * \brief This is the default EvaluationCache constructor
+   */
+  EvaluationCache() { maxsize = 0; counter = 0; numhits = 0; nummisses = 0; };
+  /**
+   * \brief This is the default EvaluationCache destructor
+   */
+  ~EvaluationCache() {};
+  /**
+   * \brief This function will set the maximum number of points that will be stored
+   * \param size is the maximum number of points
+   */
+  void setSize(int size) { maxsize = size; };
+  /**
+   * \brief This function will return the flag used to denote whether points are stored or not
+   * \return flag
+   */
+  int isActive() const { return (maxsize > 0); };
+  /**
+   * \brief This function will find a point that has already been evaluated
+   * \param point is the DoubleVector of the parameter values
+   * \return index of the stored point, or -1 if the point hasnt been stored
+   */
+  int Find(const DoubleVector& point);
+  /**
+   * \brief This function will return the likelihood score for a stored point
+   * \param entry is the index of the stored point
+   * \return likelihood score
+   */
+  double getScore(int entry) const { return scores[entry]; };
+  /**
+   * \brief This function will return the values of the parameters at the end of the model run for a stored point
+   * \param entry is the index of the stored point
+   * \return DoubleVector of the parameter values
+   * \note These values can be different to the values that were used to find the point, since the bound likelihood component can change the values
+   */
+  const DoubleVector& getValues(int entry) const { return values[entry]; };
+  /**
+   * \brief This function will return the unweighted likelihood scores from each likelihood component for a stored point
+   * \param entry is the index of the stored point
+   * \return DoubleVector of the unweighted likelihood scores
+   */
+  const DoubleVector& getLikelihoods(int entry) const { return likes[entry]; };
+  /**
+   * \brief This function will store the likelihood score for a point
+   * \param point is the DoubleVector of the parameter values
+   * \param val is the DoubleVector of the parameter values at the end of the model run
+   * \param score is the likelihood score
+   * \param likevalues is the DoubleVector of the unweighted likelihood scores from each likelihood component
+   */
+  void Store(const DoubleVector& point, const DoubleVector& val, double score, const DoubleVector& likevalues);
+  /**
+   * \brief This function will store the likelihood score for a point
+   * \param point is the DoubleVector of the parameter values
+   * \param keeper is the Keeper for the current model, containing the parameter values at the end of the model run
+   * \param score is the likelihood score
+   * \param likevec is the LikelihoodPtrVector of the likelihood components for the model run
+   */
+  void Store(const DoubleVector& point, const Keeper* const keeper, double score, const LikelihoodPtrVector& likevec);
+  /**
+   * \brief This function will write the number of points that were found and not found to the log file
+   */
+  void logStatistics() const;
+private:
+  /**
+   * \brief This function will find the index of the row that a new point will be stored in
+   * \param point is the DoubleVector of the parameter values
+   * \param numlikes is the number of likelihood components
+   * \return index of the row
+   */
+  int newEntry(const DoubleVector& point, int numlikes);
+  /**
+   * \brief This function will calculate the hash value used to compare points quickly
+   * \param point is the DoubleVector of the parameter values
+   * \return hash value
+   */
+  int hashPoint(const DoubleVector& point) const;
+  /**
+   * \brief This is the maximum number of points that will be stored
+   */
+  int maxsize;
+  /**
+   * \brief This is the counter used to record when each point was last used
+   */
+  int counter;
+  /**
+   * \brief This is the number of points that have been found
+   */
+  int numhits;
+  /**
+   * \brief This is the number of points that have not been found
+   */
+  int nummisses;
+  /**
+   * \brief This is the DoubleMatrix of the parameter values for each stored point
+   */
+  DoubleMatrix points;
+  /**
+   * \brief This is the DoubleMatrix of the parameter values at the end of the model run for each stored point
+   */
+  DoubleMatrix values;
+  /**
+   * \brief This is the DoubleMatrix of the unweighted likelihood scores for each stored point
+   */
+  DoubleMatrix likes;
+  /**
+   * \brief This is the DoubleVector of the likelihood score for each stored point
+   */
+  DoubleVector scores;
+  /**
+   * \brief This is the IntVector of the hash value for each stored point
+   */
+  IntVector hashes;
+  /**
+   * \brief This is the IntVector of the value of the counter when each stored point was last used
+   */
+  IntVector lastused;
+};
+
+#endif
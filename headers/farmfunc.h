@@ -0,0 +1,77 @@
+#ifndef farmfunc_h
+#define farmfunc_h
+
+#include "doublevector.h"
+
+/**
+ * \brief This is the version number of the protocol used to communicate with the worker processes
+ */
+const int FARMVERSION = 2;
+
+/**
+ * \brief This is the enumerated list of the requests that can be sent to a Gadget worker process
+ * \note A request starts with the tag, and for FARMSIMULATE this is followed by an identifier for the request and the value of each of the switches in the model.  The reply is the identifier, the likelihood score, the unweighted likelihood score from each likelihood component and the value of each of the switches at the end of the model run
+ */
+enum FarmTag { FARMSTOP = 0, FARMSIMULATE };
+
+/**
+ * \brief This is the function that will write an integer to a worker connection
+ * \param fd is the file descriptor of the connection
+ * \param value is the integer to be written
+ * \return 1 if the value was written, 0 otherwise
+ */
+int farmWriteInt(int fd, int value);
+/**
+ * \brief This is the function that will read an integer from a worker connection
+ * \param fd is the file descriptor of the connection
+ * \param value is the integer that will be read
+ * \return 1 if the value was read, 0 otherwise
+ */
+int farmReadInt(int fd, int& value);
+/**
+ * \brief This is the function that will write a double to a worker connection
+ * \param fd is the file descriptor of the connection
+ * \param value is the double to be written
+ * \return 1 if the value was written, 0 otherwise
+ */
+int farmWriteDouble(int fd, double value);
+/**
+ * \brief This is the function that will read a double from a worker connection
+ * \param fd is the file descriptor of the connection
+ * \param value is the double that will be read
+ * \return 1 if the value was read, 0 otherwise
+ */
+int farmReadDouble(int fd, double& value);
+/**
+ * \brief This is the function that will write a vector of doubles to a worker connection
+ * \param fd is the file descriptor of the connection
+ * \param vec is the DoubleVector to be written
+ * \return 1 if the vector was written, 0 otherwise
+ * \note The size of the vector is not written, since this is known to both ends of the connection
+ */
+int farmWriteVector(int fd, const DoubleVector& vec);
+/**
+ * \brief This is the function that will read a vector of doubles from a worker connection
+ * \param fd is the file descriptor of the connection
+ * \param vec is the DoubleVector that will be read, which must be the correct size
+ * \return 1 if the vector was read, 0 otherwise
+ */
+int farmReadVector(int fd, DoubleVector& vec);
+/**
+ * \brief This is the function that will write a string to a worker connection
+ * \param fd is the file descriptor of the connection
+ * \param text is the string to be written
+ * \return 1 if the string was written, 0 otherwise
+ * \note The string is written as the length of the string followed by the characters, without the terminating null character
+ */
+int farmWriteString(int fd, const char* text);
+/**
+ * \brief This is the function that will read the characters of a string from a worker connection
+ * \param fd is the file descriptor of the connection
+ * \param text is the string that will be read, which must have space for len+1 characters
+ * \param len is the number of characters to read
+ * \return 1 if the string was read, 0 otherwise
+ */
+int farmReadString(int fd, char* text, int len);
+
+#endif
@@ -10,6 +10,8 @@
 #include "predatorptrvector.h"
 #include "preyptrvector.h"
 #include "intmatrix.h"
+#include "intvector.h"
+#include "aggregationplan.h"
 
 /**
  * \class FleetPreyAggregator
@@ -94,6 +96,27 @@ private:
    * \brief This is the AgeBandMatrixPtrVector used to store the aggregated catch
    */
   AgeBandMatrixPtrVector total;
+  /**
+   * \brief This is the AggregationPlan used to store the entries that are added together when aggregating the catch
+   * \note There is one group in the plan for each fleet, stock and area that is to be aggregated
+   */
+  AggregationPlan plan;
+  /**
+   * \brief This is the IntVector used to store the index of the fleet for each group in the plan
+   */
+  IntVector grouppred;
+  /**
+   * \brief This is the IntVector used to store the index of the stock for each group in the plan
+   */
+  IntVector groupstock;
+  /**
+   * \brief This is the IntVector used to store the index of the stock, in the list of preys of the fleet, for each group in the plan
+   */
+  IntVector groupprey;
+  /**
+   * \brief This is the IntVector used to store the area for each group in the plan
+   */
+  IntVector grouparea;
   /**
    * \brief This is the DoubleVector used to temporarily store suitability information when aggregating the catch
    */
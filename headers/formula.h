@@ -109,6 +109,10 @@ private:
    * \brief This is the vector of arguments for the Formula function
    */
   vector<Formula*> argList;
+  /**
+   * \brief This is the Keeper for the model that the parameter belongs to, which records when the parameter is used in the model simulation
+   */
+  Keeper* owner;
 };
 
 #endif
@@ -19,6 +19,7 @@ This document is the developers manual for Gadget, and describes the classes, fu
 /* Older compilers need these to be declared in the old format    */
 #include <cassert>
 #include <cctype>
+#include <cerrno>
 #include <cstdio>
 #include <cstdlib>
 #include <cstring>
@@ -33,8 +34,15 @@ This document is the developers manual for Gadget, and describes the classes, fu
 #include <unistd.h>
 #ifdef NOT_WINDOWS
 #include <sys/utsname.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <sys/wait.h>
+#include <poll.h>
 #endif
 #include <sys/param.h>
+#ifdef GADGET_THREADS
+#include <pthread.h>
+#endif
 
 /* This is a nasty hack to use the functions in the std namespace */
 /* it would be much better to explicitly state the std namespace  */
@@ -61,6 +69,9 @@ const double rathersmall = 1e-10;
 const double verysmall = 1e-20;
 const char chrComment = ';';
 const char sep = ' ';
+const int REPEATBATCH = 64;                    /* lines per model instance when running -i files */
+const int EVALCACHESIZE = 1000;                /* default number of points in the evaluation cache */
+const int MAXCHECKPOINTS = 10;                 /* largest number of snapshots of the model for each model run */
 
 #ifndef TAB
 #define TAB '\t'
@@ -110,6 +110,17 @@ public:
    */
   int getFixedWeights() { return fixedweights; };
 protected:
+  /**
+   * \brief This function will clear the cached growth distributions if the value of beta has changed
+   */
+  void checkGrowthCache();
+  /**
+   * \brief This function will set the distribution of the length increase for a length group on an area, from the beta binomial distribution for the current value of growth
+   * \param inarea is the internal area identifier for the length increase
+   * \param lgroup is the length group identifier for the length increase
+   * \note The distributions are cached, and only recalculated when the mean growth for the length group has changed
+   */
+  void setLengthGrowth(int inarea, int lgroup);
   /**
    * \brief This is the PopInfoMatrix used to store information about the current population of the stock that is to grow according to the growth calculations
    */
@@ -205,6 +216,38 @@ protected:
    * \note This stores the value of gamma(x+alpha)/gamma(x)
    */
   DoubleVector part4;
+  /**
+   * \brief This is the DoubleMatrix used to store the cached beta binomial distribution for each length group
+   */
+  DoubleMatrix lgrowthcache;
+  /**
+   * \brief This is the DoubleVector of the mean growth used to calculate the cached distribution for each length group
+   */
+  DoubleVector cachegrowth;
+  /**
+   * \brief This is the DoubleMatrix of the mean growth used to calculate the distribution for each length group currently stored on each area
+   */
+  DoubleMatrix lgrowthkey;
+  /**
+   * \brief This is the value of beta used to calculate the cached distributions
+   */
+  double cachebeta;
+  /**
+   * \brief This is the flag used to denote whether the cached distributions can be used
+   */
+  int cachevalid;
+  /**
+   * \brief This is the IntVector of flags used to denote whether the fixed weight increase has been calculated on each area
+   */
+  IntVector wgrowthset;
+  /**
+   * \brief This is the DoubleVector of the multiplier used to calculate the fixed weight increase on each area
+   */
+  DoubleVector wgrowthmult;
+  /**
+   * \brief This is the DoubleVector of the power used to calculate the fixed weight increase on each area
+   */
+  DoubleVector wgrowthpower;
 };
 
 #endif
@@ -53,6 +53,35 @@ public:
    * \return 0 (will be overridden in derived classes)
    */
   virtual double getMult() { return 0.0; };
+protected:
+  /**
+   * \brief This function will calculate the mean length of each length group raised to a power
+   * \param LgrpDiv is the LengthGroupDivision of the stock
+   * \param power is the power that the mean lengths are raised to
+   * \return pointer to the array of the calculated values, indexed by length group
+   */
+  const double* calcLengthPower(const LengthGroupDivision* const LgrpDiv, double power);
+  /**
+   * \brief This function will calculate the mean weight of each length group, divided by a scale factor, raised to a power
+   * \param numGrow is the PopInfoVector of the current population of the stock
+   * \param scale is the scale factor that the mean weights are divided by
+   * \param power is the power that the scaled mean weights are raised to
+   * \param result is the DoubleVector that the calculated values are stored in
+   * \return pointer to the array of the calculated values, indexed by length group
+   */
+  const double* calcWeightPower(const PopInfoVector& numGrow, double scale, double power, DoubleVector& result);
+  /**
+   * \brief This is the DoubleVector used to store the mean lengths raised to a power
+   */
+  DoubleVector lengthpower;
+  /**
+   * \brief This is the DoubleVector used to store the mean weights raised to a power
+   */
+  DoubleVector weightpower;
+  /**
+   * \brief This is the DoubleVector used to store the mean weights raised to a second power, for the growth functions that need two terms
+   */
+  DoubleVector weightpower2;
 };
 
 /**
@@ -55,6 +55,14 @@ public:
    */
   void Print(ofstream& outfile) const;
 protected:
+  /**
+   * \brief This function will calculate the normal length distribution for one age group
+   * \param pop is the PopInfoIndexVector that the length distribution is stored in
+   * \param mean is the mean length of the age group
+   * \param mult is the inverse of the standard deviation of the length of the age group
+   * \return the sum of the length distribution
+   */
+  double calcNormalDistribution(PopInfoIndexVector& pop, double mean, double mult);
   /**
    * \brief This is the function used to read the normal distribution and condition factor for the initial condtion data
    * \param infile is the CommentStream to read the initial conditions data from
@@ -89,6 +97,10 @@ protected:
    * \brief This is the LengthGroupDivision of the initial population of the stock
    */
   LengthGroupDivision* LgrpDiv;
+  /**
+   * \brief This is the DoubleVector used to store the values when calculating a normal length distribution
+   */
+  DoubleVector normdist;
   /**
    * \brief This is the ConversionIndex used to convert from the initial population LengthGroupDivision to the stock LengthGroupDivision
    */
@@ -141,6 +153,10 @@ protected:
    * \brief This is the identifier of the function to be used to read the initial population data from file
    */
   int readoption;
+  /**
+   * \brief This is the flag to denote whether any of the parameters used to calculate the initial population have changed since the last model run
+   */
+  int parchanged;
 };
 
 #endif
@@ -1,6 +1,8 @@
 #ifndef interruptinterface_h
 #define interruptinterface_h
 
+class Ecosystem;
+
 /**
  * \class InterruptInterface
  * \brief This is the class used to communicate with the user after an interrupt
@@ -9,8 +11,9 @@ class InterruptInterface {
 public:
   /**
    * \brief This is the InterruptInterface constructor
+   * \param eco is the Ecosystem that has been interrupted
    */
-  InterruptInterface() {};
+  InterruptInterface(Ecosystem* const eco) { EcoSystem = eco; };
   /**
    * \brief This is the default InterruptInterface destructor
    */
@@ -25,6 +28,10 @@ private:
    * \brief This is the function used to print a menu to communicate with the user
    */
   void printMenu();
+  /**
+   * \brief This is the Ecosystem that has been interrupted
+   */
+  Ecosystem* EcoSystem;
 };
 
 #endif
@@ -7,6 +7,8 @@
 #include "stochasticdata.h"
 #include "addresskeepermatrix.h"
 #include "strstack.h"
+#include "stockptrvector.h"
+#include "gadget.h"
 
 /**
  * \class Keeper
@@ -41,6 +43,29 @@ public:
    * \param post is the new value for the variable
    */
   void changeVariable(const double& pre, double& post);
+  /**
+   * \brief This function will start recording the parameters that are used by a model component, so that the component can be told when any of these parameters have changed
+   * \param flag is the flag that will be set to 1 whenever the value of any parameter that is registered before the next call to clearDependency() is changed
+   */
+  void setDependency(int* const flag);
+  /**
+   * \brief This function will stop recording the parameters that are used by the model component given in the last call to setDependency()
+   */
+  void clearDependency();
+  /**
+   * \brief This function will register the flag that a model component sets when a NaN is found in the model
+   * \param flag is the flag that will be set to 1 by the model component when a NaN is found
+   */
+  void addNaNFlag(int* const flag) { nanflags.push_back(flag); };
+  /**
+   * \brief This function will return the flag denoting whether a NaN has been found in the model
+   * \return 1 if any of the registered model components has found a NaN, 0 otherwise
+   */
+  int getNaNFlag() const;
+  /**
+   * \brief This function will clear the flags of all the model components that record whether a NaN has been found
+   */
+  void clearNaNFlags() const;
   /**
    * \brief This function will set the text string that is used to describe a variable
    * \param str is the text string to be stored
@@ -159,6 +184,12 @@ public:
    * \param Stoch is the StochasticData containing the new values of the variables
    */
   void Update(const StochasticData* const Stoch);
+  /**
+   * \brief This function will update the Keeper variables with the values, bounds and optimisation flags from another Keeper
+   * \param keeper is the Keeper containing the new values of the variables
+   * \note The other Keeper must have been created from the same model input files
+   */
+  void Update(const Keeper* const keeper);
   /**
    * \brief This function will open the output file and write header information
    * \param filename is the name of the file to write the model information to
@@ -172,17 +203,31 @@ public:
   /**
    * \brief This function will write current information about the model parameters to file
    * \param likevec is the LikelihoodPtrVector containing the likelihood components for the current model
+   * \param funceval is the number of function evaluations completed before the model run
+   * \param likelihood is the likelihood score for the model run
+   * \param prec is the precision to use in the output file
+   */
+  void writeValues(const LikelihoodPtrVector& likevec, int funceval, double likelihood, int prec);
+  /**
+   * \brief This function will write information about a model run to file
+   * \param val is the DoubleVector containing the values of the parameters for the model run
+   * \param likevalues is the DoubleVector containing the unweighted likelihood components for the model run
+   * \param funceval is the number of function evaluations completed before the model run
+   * \param likelihood is the likelihood score for the model run
    * \param prec is the precision to use in the output file
    */
-  void writeValues(const LikelihoodPtrVector& likevec, int prec);
+  void writeValues(const DoubleVector& val, const DoubleVector& likevalues, int funceval, double likelihood, int prec);
   /**
    * \brief This function will write final information about the model parameters to file in a column format (which can then be used as the starting point for a subsequent model run)
    * \param optvec is the OptInfoPtrVector containing the optimisation algorithms used for the current model
    * \param filename is the name of the file to write the model information to
+   * \param funceval is the number of function evaluations completed for the current model
+   * \param likelihood is the likelihood score for the current model
    * \param prec is the precision to use in the output file
    * \param interrupt is the flag to denote whether the current run was interrupted by the user or not
    */
-  void writeParams(const OptInfoPtrVector& optvec, const char* const filename, int prec, int interrupt);
+  void writeParams(const OptInfoPtrVector& optvec, const char* const filename,
+    int funceval, double likelihood, int prec, int interrupt);
   /**
    * \brief This function will display information about the best values of the parameters found so far during an optimisation run
    */
@@ -202,6 +247,52 @@ public:
    * \return bestlikelihood
    */
   double getBestLikelihoodScore() const { return bestlikelihood; };
+  /**
+   * \brief This function will set the StockPtrVector of the stocks for the current model
+   * \param stocks is the StockPtrVector of the stocks for the current model
+   * \note The stocks are used to calculate the value of any stock-dependent variables
+   */
+  void setModelStocks(const StockPtrVector* const stocks) { modelstocks = stocks; };
+  /**
+   * \brief This function will return the StockPtrVector of the stocks for the current model
+   * \return modelstocks
+   */
+  const StockPtrVector* getModelStocks() const { return modelstocks; };
+  /**
+   * \brief This function will start recording the earliest timestep that each parameter is used in the model simulation
+   * \note The earliest timestep is kept from one recorded model run to the next, so this is the earliest timestep that has been found for any of the recorded model runs
+   */
+  void startTrace();
+  /**
+   * \brief This function will set the timestep that is recorded for any parameters that are used
+   * \param step is the current timestep, where 0 is used for the start of the model simulation
+   */
+  void setTraceStep(int step) { tracestep = step; };
+  /**
+   * \brief This function will stop recording the earliest timestep that each parameter is used in the model simulation
+   */
+  void stopTrace() { tracing = 0; };
+  /**
+   * \brief This function will check to see if the parameters that are used should be recorded
+   * \return 1 if the parameters are being recorded on the current thread, 0 otherwise
+   * \note The parameters are only recorded on the thread that is running the model simulation
+   */
+#ifdef GADGET_THREADS
+  int isTracing() const { return ((tracing) && (pthread_equal(tracethread, pthread_self()))); };
+#else
+  int isTracing() const { return tracing; };
+#endif
+  /**
+   * \brief This function will record that a parameter has been used on the current timestep
+   * \param var is the value of the parameter that has been used
+   */
+  void traceVariable(const double* const var);
+  /**
+   * \brief This function will return the earliest timestep that a parameter has been used in the model simulation
+   * \param i is the index of the parameter
+   * \return earliest timestep, or 0 if the parameter has not been used in a recorded model run
+   */
+  int getFirstUse(int i) const;
 protected:
   /**
    * \brief This is the AddressKeeperMatrix used to store information about the value and name of the parameters
@@ -260,6 +351,56 @@ protected:
    * \brief This is the flag used to denote whether an output file has been specified or not
    */
   int fileopen;
+  /**
+   * \brief This is the StockPtrVector of the stocks for the current model
+   */
+  const StockPtrVector* modelstocks;
+  /**
+   * \brief This is the sorted list of the addresses of the parameters, used to find the parameter that has been used
+   */
+  vector<const double*> traceaddr;
+  /**
+   * \brief This is the IntVector of the index of the parameter for each address in the sorted list
+   */
+  IntVector traceswitch;
+  /**
+   * \brief This is the IntVector of the earliest timestep that each parameter has been used in the model simulation
+   * \note If firstuse[i] is -1 then parameter i has not been used in a recorded model run
+   */
+  IntVector firstuse;
+  /**
+   * \brief This is the timestep that is recorded for any parameters that are used
+   */
+  int tracestep;
+  /**
+   * \brief This is the flag used to denote whether the parameters that are used are being recorded
+   */
+  int tracing;
+#ifdef GADGET_THREADS
+  /**
+   * \brief This is the thread that is running the model simulation while the parameters are being recorded
+   */
+  pthread_t tracethread;
+#endif
+  /**
+   * \brief This is the list of the flags of the model components that use each parameter
+   */
+  vector<vector<int*> > dependency;
+  /**
+   * \brief This is the list of the flags of the model components that are currently recording the parameters that they use
+   */
+  vector<int*> depstack;
+  /**
+   * \brief This is the list of the flags of the model components that record whether a NaN has been found
+   * \note Each copy of the model has its own Keeper, so a NaN found in one copy of the model doesnt change the likelihood score of another copy
+   */
+  vector<int*> nanflags;
+  /**
+   * \brief This function will set the value of each variable with a given switch, and tell the model components that use it if the value has changed
+   * \param i is the index of the switch
+   * \param value is the new value of the variable
+   */
+  void writeVariable(int i, double value);
   /**
    * \brief This ofstream is the file that all the parameter information gets sent to
    */
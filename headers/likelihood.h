@@ -100,6 +100,12 @@ public:
    * \param Stocks is the StockPtrVector of all the available stocks
    */
   virtual void setFleetsAndStocks(FleetPtrVector& Fleets, StockPtrVector& Stocks) {};
+  /**
+   * \brief This will return whether the likelihood score can only increase during a model simulation
+   * \return 1 if the score added on each timestep cant be negative, 0 otherwise
+   * \note This is used to stop a model simulation early once the likelihood score is already worse than a given score, so it should only be overridden for the components where this is certain
+   */
+  virtual int isIncreasing() const { return 0; };
 protected:
   /**
    * \brief This stores the calculated score for the likelihood component
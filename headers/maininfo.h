@@ -65,6 +65,16 @@ public:
    * \param filename is the name of the file
    */
   void setOptInfoFile(char* filename);
+  /**
+   * \brief This function will store the filename of the socket that a network run will be served on
+   * \param filename is the name of the socket
+   */
+  void setSocketFile(char* filename);
+  /**
+   * \brief This function will store the filename that the time spent in each part of the model simulation will be written to
+   * \param filename is the name of the file
+   */
+  void setProfileFile(char* filename);
   /**
    * \brief This function will return the flag used to determine whether the likelihood score should be optimised
    * \return flag
@@ -100,6 +110,11 @@ public:
    * \return flag
    */
   int getForcePrint() const { return forceprint; };
+  /**
+   * \brief This function will return the flag used to determine whether faster approximations to the math functions should be used
+   * \return flag
+   */
+  int getFastMath() const { return fastmath; };
   /**
    * \brief This function will return the PrintInfo used to store printing information
    * \return pi, the PrintInfo containing the printing information
@@ -145,6 +160,51 @@ public:
    * \return maxratio
    */
   double getMaxRatio() const { return maxratio; };
+  /**
+   * \brief This function will return the number of worker processes used to evaluate the model
+   * \return numforks
+   */
+  int getNumForks() const { return numforks; };
+  /**
+   * \brief This function will return the number of threads used to evaluate the model
+   * \return numthreads
+   */
+  int getNumThreads() const { return numthreads; };
+  /**
+   * \brief This function will return the number of threads used within each simulation of the model
+   * \return numsimthreads
+   */
+  int getNumSimThreads() const { return numsimthreads; };
+  /**
+   * \brief This function will return the number of snapshots of the model that will be kept to resume the simulation from
+   * \return numcheckpoints
+   */
+  int getNumCheckpoints() const { return numcheckpoints; };
+  /**
+   * \brief This function will return the maximum number of points that will be stored in the evaluation cache
+   * \return evalcachesize
+   */
+  int getEvalCacheSize() const { return evalcachesize; };
+  /**
+   * \brief This function will return the flag used to determine whether a socket has been given for a network run
+   * \return flag
+   */
+  int getSocketGiven() const { return givenSocket; };
+  /**
+   * \brief This function will return the name of the socket that a network run will be served on
+   * \return filename
+   */
+  char* getSocketFile() const { return strSocketFile; };
+  /**
+   * \brief This function will return the flag used to determine whether the time spent in each part of the model simulation should be recorded
+   * \return flag
+   */
+  int getProfileGiven() const { return givenProfile; };
+  /**
+   * \brief This function will return the name of the file that the time spent in each part of the model simulation will be written to
+   * \return filename
+   */
+  char* getProfileFile() const { return strProfileFile; };
 private:
   /**
    * \brief This function will read input from a file instead of the command line
@@ -171,6 +231,14 @@ private:
    * \brief This is the name of the file that the main model information will be read from
    */
   char* strMainGadgetFile;
+  /**
+   * \brief This is the name of the socket that a network run will be served on
+   */
+  char* strSocketFile;
+  /**
+   * \brief This is the name of the file that the time spent in each part of the model simulation will be written to
+   */
+  char* strProfileFile;
   /**
    * \brief This is the PrintInfo used to store information about the format the model parameters should be written to file
    */
@@ -203,6 +271,10 @@ private:
    * \brief This is the flag used to override the default settings and force the model to print model output at the end of an optimisation run
    */
   int forceprint;
+  /**
+   * \brief This is the flag used to denote whether faster approximations to the math functions should be used in the model simulation
+   */
+  int fastmath;
   /**
    * \brief This is the flag used to denote whether the initial model information should be printed or not
    */
@@ -219,6 +291,34 @@ private:
    * \brief This is the maximum ratio of a stock that can be consumed on any given timestep
    */
   double maxratio;
+  /**
+   * \brief This is the number of worker processes that will be used to evaluate the model
+   */
+  int numforks;
+  /**
+   * \brief This is the number of threads that will be used to evaluate the model
+   */
+  int numthreads;
+  /**
+   * \brief This is the number of threads that will be used within each simulation of the model
+   */
+  int numsimthreads;
+  /**
+   * \brief This is the number of snapshots of the model that will be kept to resume the simulation from
+   */
+  int numcheckpoints;
+  /**
+   * \brief This is the maximum number of points that will be stored in the evaluation cache
+   */
+  int evalcachesize;
+  /**
+   * \brief This is the flag used to denote whether a socket has been given for a network run or not
+   */
+  int givenSocket;
+  /**
+   * \brief This is the flag used to denote whether the time spent in each part of the model simulation should be recorded or not
+   */
+  int givenProfile;
 };
 
 #endif
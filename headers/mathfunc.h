@@ -128,4 +128,67 @@ inline double calcMortality(double pred, double pop, double t) {
   return (-log(1.0 - (pred / pop)) * t);
 }
 
+/**
+ * \brief This is the enumerated type of the modes used to calculate the vector versions of the math functions
+ */
+enum MathMode { MATHEXACT = 0, MATHFAST };
+
+/**
+ * \brief This is the largest error allowed for the faster approximations to the math functions
+ */
+const double mathaccuracy = 1e-12;
+
+/**
+ * \brief This function will set the mode used to calculate the vector versions of the math functions
+ * \param mode is the MathMode to use, MATHEXACT to use the standard math library or MATHFAST to use faster approximations
+ * \note The mode should be set before the model simulation starts, since it is shared between all the model threads
+ */
+void setMathMode(int mode);
+
+/**
+ * \brief This function will return the mode used to calculate the vector versions of the math functions
+ * \return mathmode
+ */
+int getMathMode();
+
+/**
+ * \brief This function will calculate the exponential of each entry in an array
+ * \param result is the array that the results are stored in, which can be the same as x
+ * \param x is the array of numbers that the exponential will be calculated for
+ * \param n is the number of entries in the arrays
+ */
+void calcExpVector(double* result, const double* x, int n);
+
+/**
+ * \brief This function will calculate the logarithm of each entry in an array
+ * \param result is the array that the results are stored in, which can be the same as x
+ * \param x is the array of numbers that the logarithm will be calculated for
+ * \param n is the number of entries in the arrays
+ */
+void calcLogVector(double* result, const double* x, int n);
+
+/**
+ * \brief This function will raise each entry in an array to the same power
+ * \param result is the array that the results are stored in, which can be the same as x
+ * \param x is the array of numbers that will be raised to the power
+ * \param power is the power that each number will be raised to
+ * \param n is the number of entries in the arrays
+ */
+void calcPowVector(double* result, const double* x, double power, int n);
+
+/**
+ * \brief This function will calculate the logarithm of the gamma function of each entry in an array
+ * \param result is the array that the results are stored in, which can be the same as x
+ * \param x is the array of numbers that the log gamma function will be calculated for
+ * \param n is the number of entries in the arrays
+ * \note The log factorial of n is the log gamma function of n + 1
+ */
+void calcLogGammaVector(double* result, const double* x, int n);
+
+/**
+ * \brief This function will check the accuracy of the fast approximations to the math functions
+ * \return the largest error found, relative to the value from the standard math library (or absolute for values less than 1)
+ */
+double checkMathAccuracy();
+
 #endif
@@ -9,6 +9,7 @@
 #include "commentstream.h"
 #include "agebandmatrixptrvector.h"
 #include "agebandmatrixratioptrvector.h"
+#include "doublematrixptrvector.h"
 #include "modelvariablevector.h"
 
 /**
@@ -78,6 +79,24 @@ public:
    * \param weight is the weight of the calculated mature stock
    */
   void storeMatureStock(int area, int age, int length, double number, double weight);
+  /**
+   * \brief This will store the calculated mature stock for a range of length groups
+   * \param area is the area that the maturation is being calculated on
+   * \param age is the age of the calculated mature stock
+   * \param minlength is the first length of the calculated mature stock
+   * \param numlength is the number of lengths of the calculated mature stock
+   * \param number is the array of the numbers of the calculated mature stock
+   * \param weight is the array of the weights of the calculated mature stock
+   */
+  void storeMatureStock(int area, int age, int minlength, int numlength, const double* number, const double* weight);
+  /**
+   * \brief This will return the precalculated probability of maturation for an age group of the immature stock
+   * \param age is the age of the age-length cells that the maturation is being calculated on
+   * \param maxgrowth is the number of length groups that the immature stock can grow by
+   * \return pointer to a DoubleMatrix of the probability of maturation, indexed by growth and length, or 0 if the probability depends on the weight of the fish
+   * \note The probabilities are only recalculated when the maturation parameters have changed
+   */
+  const DoubleMatrix* getMaturationTable(int age, int maxgrowth);
   /**
    * \brief This will store the calculated mature tagged stock
    * \param area is the area that the maturation is being calculated on
@@ -113,10 +132,19 @@ public:
    */
   void deleteMaturityTag(const char* tagname);
 protected:
+  /**
+   * \brief This will check if the probability of maturation depends on the weight of the fish
+   * \return 0 (will be overridden in derived classes that depend on the weight)
+   */
+  virtual int isWeightDependent() const { return 0; };
   /**
    * \brief This is used to temporarily store the maturation ratio
    */
   double tmpratio;
+  /**
+   * \brief This is the flag used to denote whether the precalculated probabilities of maturation need to be recalculated
+   */
+  int tablechanged;
   /**
    * \brief This is the StockPtrVector of the mature stocks
    */
@@ -150,6 +178,10 @@ private:
    * \brief This is the AgeBandMatrixPtrVector used to store the calculated mature stocks
    */
   AgeBandMatrixPtrVector Storage;
+  /**
+   * \brief This is the DoubleMatrixPtrVector of the precalculated probabilities of maturation for each age group
+   */
+  DoubleMatrixPtrVector maturationTable;
   /**
    * \brief This is the AgeBandMatrixRatioPtrVector used to store the calculated mature tagged stocks
    */
@@ -449,6 +481,11 @@ public:
    */
   virtual void Print(ofstream& outfile) const;
 protected:
+  /**
+   * \brief This will check if the probability of maturation depends on the weight of the fish
+   * \return 1
+   */
+  virtual int isWeightDependent() const { return 1; };
   /**
    * \brief This is the DoubleVector of reference weight information
    */
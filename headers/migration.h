@@ -166,6 +166,10 @@ private:
    * \brief This is the FormulaMatrixPtrVector used to store the migration variables
    */
   FormulaMatrixPtrVector readMigration;
+  /**
+   * \brief This is the flag to denote whether any of the migration parameters have changed since the last model run
+   */
+  int parchanged;
 };
 
 /**
@@ -67,6 +67,11 @@ public:
    * \return 1 if the values have changed, 0 otherwise
    */
   int didChange(const TimeClass* const TimeInfo) const;
+  /**
+   * \brief This function will check to see if any of the ModelVariable values are based on the stock data
+   * \return 1 if any of the values are based on the stock data, 0 otherwise
+   */
+  int usesStockData() const;
   /**
    * \brief This function will update the ModelVariable values
    * \param TimeInfo is the TimeClass for the current model
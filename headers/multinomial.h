@@ -33,6 +33,21 @@ public:
    * \return likelihood
    */
   double calcLogLikelihood(const DoubleVector& data, const DoubleVector& dist);
+  /**
+   * \brief This is the function that calculates a log likelihood score by comparing 2 vectors based on a multinomial distribution, using a precalculated value for the terms that only depend on the input data
+   * \param data is the DoubleVector containing the input data
+   * \param dist is the DoubleVector containing the modelled data
+   * \param dataterm is the value of the terms that only depend on the input data, as returned by calcDataTerm()
+   * \return likelihood
+   */
+  double calcLogLikelihood(const DoubleVector& data, const DoubleVector& dist, double dataterm);
+  /**
+   * \brief This is the function that calculates the terms of the log likelihood score that only depend on the input data
+   * \param data is the DoubleVector containing the input data
+   * \return the sum of the log factorials of the input data, less the log factorial of the total
+   * \note Since the input data doesn't change, this only needs to be calculated once for each vector
+   */
+  double calcDataTerm(const DoubleVector& data);
   /**
    * \brief This will return the log likelihood score
    * \return loglikelihood
@@ -47,6 +62,11 @@ protected:
    * \brief This is the log likelihood score
    */
   double loglikelihood;
+  /**
+   * \brief This is the DoubleVector used to store the values that the logarithms are calculated for
+   * \note This is only resized when a larger vector is needed, so that no memory is allocated during the model simulation
+   */
+  DoubleVector scratch;
 };
 
 #endif
@@ -51,6 +51,11 @@ public:
    */
   void Print(ofstream& outfile);
 protected:
+  /**
+   * \brief This function will check to see if any of the natural mortality parameters are based on the stock data
+   * \return 1 if any of the parameters are based on the stock data, 0 otherwise
+   */
+  int usesStockData() const;
   /**
    * \brief This is the ModelVariableVector used to store the mortality of each age group
    */
@@ -71,6 +76,14 @@ protected:
    * \brief This is the identifier of the function to be used to read the natural mortality data from file
    */
   int readoption;
+  /**
+   * \brief This is the flag to denote whether any of the natural mortality parameters have changed since the last model run
+   */
+  int parchanged;
+  /**
+   * \brief This is the timestep that the proportion surviving was last calculated on
+   */
+  int calctime;
 };
 
 #endif
@@ -5,8 +5,11 @@
 #include "doublematrix.h"
 #include "doublevector.h"
 #include "intvector.h"
+#include "intmatrix.h"
 
-enum OptType { OPTHOOKE = 1, OPTSIMANN, OPTBFGS };
+class Ecosystem;
+
+enum OptType { OPTHOOKE = 1, OPTSIMANN, OPTPTSIMANN, OPTBFGS };
 
 /**
  * \class OptInfo
@@ -18,8 +21,9 @@ class OptInfo {
 public:
   /**
    * \brief This is the default OptInfo constructor
+   * \param eco is the Ecosystem that will be optimised
    */
-  OptInfo() { converge = 0; iters = 0; score = 0.0; };
+  OptInfo(Ecosystem* const eco) { EcoSystem = eco; converge = 0; iters = 0; score = 0.0; threads = 1; threadsgiven = 0; };
   /**
    * \brief This is the default OptInfo destructor
    */
@@ -45,7 +49,22 @@ public:
    * \return type
    */
   OptType getType() const { return type; };
+  /**
+   * \brief This will return the number of model instances that the optimisation algorithm can use at the same time
+   * \return threads
+   */
+  int getNumThreads() const { return threads; };
+  /**
+   * \brief This function will set the number of model instances that the optimisation algorithm can use at the same time, if this hasnt been specified in the optimisation file
+   * \param num is the number of model instances
+   * \note This is only used by the optimisation algorithms that can evaluate a batch of points at the same time
+   */
+  virtual void setDefaultThreads(int num) {};
 protected:
+  /**
+   * \brief This is the Ecosystem that will be optimised
+   */
+  Ecosystem* EcoSystem;
   /**
    * \brief This is the flag used to denote whether the optimisation converged or not
    */
@@ -62,6 +81,14 @@ protected:
    * \brief This denotes what type of optimisation class has been created
    */
   OptType type;
+  /**
+   * \brief This is the number of model instances that the optimisation algorithm can use at the same time
+   */
+  int threads;
+  /**
+   * \brief This is the flag used to denote whether the number of model instances has been specified in the optimisation file or not
+   */
+  int threadsgiven;
 };
 
 /**
@@ -77,8 +104,9 @@ class OptInfoHooke : public OptInfo {
 public:
   /**
    * \brief This is the default OptInfoHooke constructor
+   * \param eco is the Ecosystem that will be optimised
    */
-  OptInfoHooke();
+  OptInfoHooke(Ecosystem* const eco);
   /**
    * \brief This is the default OptInfoHooke destructor
    */
@@ -99,6 +127,11 @@ public:
    * \brief This is the function that will calculate the likelihood score using the Hooke & Jeeves optimiser
    */
   virtual void OptimiseLikelihood();
+  /**
+   * \brief This function will set the number of model instances that the Hooke & Jeeves optimiser can use at the same time, if this hasnt been specified in the optimisation file
+   * \param num is the number of model instances
+   */
+  virtual void setDefaultThreads(int num) { if (!threadsgiven) threads = num; };
 private:
   /**
    * \brief This function will calculate the best point that can be found close to the current point
@@ -109,6 +142,16 @@ private:
    * \return the best function value found from the search
    */
   double bestNearby(DoubleVector& delta, DoubleVector& point, double prevbest, IntVector& param);
+  /**
+   * \brief This function will calculate the best point that can be found close to the current point, evaluating the steps for a batch of parameters at the same time
+   * \param delta is the DoubleVector of the steps to take when looking for the best point
+   * \param point is the DoubleVector that will contain the parameters corresponding to the best function value found from the search
+   * \param prevbest is the current best point value
+   * \param param is the IntVector containing the order that the parameters should be searched in
+   * \return the best function value found from the search
+   * \note The moves accepted from each batch are applied in the order given by param, so the search is reproducible for a given seed and number of threads
+   */
+  double bestNearbyParallel(DoubleVector& delta, DoubleVector& point, double prevbest, IntVector& param);
   /**
    * \brief This is the maximum number of iterations for the Hooke & Jeeves optimisation
    */
@@ -129,6 +172,10 @@ private:
    * \brief This is the limit when checking if a parameter is stuck on the bound
    */
   double bndcheck;
+  /**
+   * \brief This is the DoubleVector used to store the trial point when looking for the best point close to the current point
+   */
+  DoubleVector nearby;
 };
 
 /**
@@ -143,8 +190,9 @@ class OptInfoSimann : public OptInfo {
 public:
   /**
    * \brief This is the default OptInfoSimann constructor
+   * \param eco is the Ecosystem that will be optimised
    */
-  OptInfoSimann();
+  OptInfoSimann(Ecosystem* const eco);
   /**
    * \brief This is the default OptInfoSimann destructor
    */
@@ -216,6 +264,96 @@ private:
   int scale;
 };
 
+/**
+ * \class OptInfoPTSimann
+ * \brief This is the class used for the Parallel Tempering Simulated Annealing optimisation
+ *
+ * Parallel Tempering Simulated Annealing runs several Simulated Annealing chains at the same time, each at a different temperature.  The trial points for all the chains are evaluated as one batch, so each chain can use a separate copy of the model.  After each sweep through the parameters the algorithm will try to exchange the points of neighbouring chains, using the Metropolis criteria for the difference in temperature, which lets the colder chains escape from local optima that have been found by the hotter chains.  The best point found by any of the chains is stored as the best point for the optimisation.
+ *
+ * The trial points, acceptance decisions and exchanges are all calculated in a fixed order, so the optimisation is reproducible for a given seed and number of chains.
+ */
+class OptInfoPTSimann : public OptInfo {
+public:
+  /**
+   * \brief This is the default OptInfoPTSimann constructor
+   * \param eco is the Ecosystem that will be optimised
+   */
+  OptInfoPTSimann(Ecosystem* const eco);
+  /**
+   * \brief This is the default OptInfoPTSimann destructor
+   */
+  virtual ~OptInfoPTSimann() {};
+  /**
+   * \brief This is the function used to read in the Parallel Tempering Simulated Annealing parameters
+   * \param infile is the CommentStream to read the optimisation parameters from
+   * \param text is a text string used to compare parameter names
+   */
+  virtual void read(CommentStream& infile, char* text);
+  /**
+   * \brief This function will print information from the optimisation algorithm
+   * \param outfile is the ofstream that the optimisation information gets sent to
+   * \param prec is the precision to use in the output file
+   */
+  virtual void Print(ofstream& outfile, int prec);
+  /**
+   * \brief This is the function that will calculate the likelihood score using the Parallel Tempering Simulated Annealing optimiser
+   */
+  virtual void OptimiseLikelihood();
+private:
+  /**
+   * \brief This is the temperature reduction factor
+   */
+  double rt;
+  /**
+   * \brief This is the halt criteria for the Parallel Tempering Simulated Annealing algorithm
+   */
+  double ptsimanneps;
+  /**
+   * \brief This is the number of loops before the step length is adjusted
+   */
+  int ns;
+  /**
+   * \brief This is the number of loops before the temperature is adjusted
+   */
+  int nt;
+  /**
+   * \brief This is the "temperature" used for the coldest chain
+   */
+  double t;
+  /**
+   * \brief This is the ratio between the temperatures of neighbouring chains
+   */
+  double tratio;
+  /**
+   * \brief This is the factor used to adjust the step length
+   */
+  double cs;
+  /**
+   * \brief This is the initial value for the maximum step length
+   */
+  double vminit;
+  /**
+   * \brief This is the maximum number of function evaluations for the Parallel Tempering Simulated Annealing optimiation
+   */
+  int ptsimanniter;
+  /**
+   * \brief This is the upper bound when adjusting the step length
+   */
+  double uratio;
+  /**
+   * \brief This is the lower bound when adjusting the step length
+   */
+  double lratio;
+  /**
+   * \brief This is the number of temperature loops to check when testing for convergence
+   */
+  int tempcheck;
+  /**
+   * \brief This is the flag to denote whether the parameters should be scaled or not (default 0, not scale)
+   */
+  int scale;
+};
+
 /**
  * \class OptInfoBFGS
  * \brief This is the class used for the BFGS optimisation
@@ -228,8 +366,9 @@ class OptInfoBFGS : public OptInfo  {
 public:
   /**
    * \brief This is the default OptInfoBFGS constructor
+   * \param eco is the Ecosystem that will be optimised
    */
-  OptInfoBFGS();
+  OptInfoBFGS(Ecosystem* const eco);
   /**
    * \brief This is the default OptInfoBFGS destructor
    */
@@ -250,6 +389,11 @@ public:
    * \brief This is the function that will calculate the likelihood score using the BFGS optimiser
    */
   virtual void OptimiseLikelihood();
+  /**
+   * \brief This function will set the number of model instances that the BFGS optimiser can use at the same time, if this hasnt been specified in the optimisation file
+   * \param num is the number of model instances
+   */
+  virtual void setDefaultThreads(int num) { if (!threadsgiven) threads = num; };
 private:
   /**
    * \brief This function will numerically calculate the gradient of the function at the current point
@@ -296,6 +440,11 @@ private:
    * \brief This is the halt criteria for the gradient accuracy term
    */
   double gradeps;
+  /**
+   * \brief This is the value of the gradient accuracy term below which the gradient is calculated using central differences
+   * \note The default value is 0, which means that forward differences are always used
+   */
+  double gradcentral;
 };
 
 #endif
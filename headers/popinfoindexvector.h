@@ -13,7 +13,7 @@ public:
   /**
    * \brief This is the default PopInfoIndexVector constructor
    */
-  PopInfoIndexVector() { minpos = 0; size = 0; v = 0; };
+  PopInfoIndexVector() { minpos = 0; size = 0; v = 0; owner = 1; };
   /**
    * \brief This is the PopInfoIndexVector constructor for a specified size
    * \param sz is the size of the vector to be created
@@ -33,11 +33,26 @@ public:
    * \param initial is the PopInfoIndexVector to copy
    */
   PopInfoIndexVector(const PopInfoIndexVector& initial);
+  /**
+   * \brief This is the PopInfoIndexVector constructor for a vector that uses memory that has been allocated elsewhere
+   * \param sz is the size of the vector to be created
+   * \param minpos is the index for the vector to be created
+   * \param store is the pointer to the first of the sz entries that the vector will use
+   * \note The memory is not owned by the vector, so it will not be freed by the destructor
+   */
+  PopInfoIndexVector(int sz, int minpos, PopInfo* store);
   /**
    * \brief This is the PopInfoIndexVector destructor
-   * \note This will free all the memory allocated to all the elements of the vector
+   * \note This will free all the memory allocated to all the elements of the vector, unless that memory is owned elsewhere
    */
   ~PopInfoIndexVector();
+  /**
+   * \brief This will set the vector to use memory that has been allocated elsewhere
+   * \param sz is the size of the vector
+   * \param minpos is the index for the vector
+   * \param store is the pointer to the first of the sz entries that the vector will use
+   */
+  void setStore(int sz, int minpos, PopInfo* store);
   /**
    * \brief This will add new entries to the vector
    * \param addsize is the number of new entries to the vector
@@ -100,6 +115,10 @@ protected:
    * \brief This is the indexed vector of PopInfo values
    */
   PopInfo* v;
+  /**
+   * \brief This is the flag used to denote whether the vector owns the memory used to store the entries
+   */
+  int owner;
 };
 
 #endif
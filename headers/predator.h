@@ -162,6 +162,11 @@ public:
    * \return suitability matrix for the prey
    */
   const DoubleMatrix& getSuitability(int i) const { return suitable->getSuitability(i); };
+  /**
+   * \brief This will return the number of times that the suitability values have been calculated
+   * \return number of calculations
+   */
+  int numSuitabilityCalculated() const { return suitable->numCalculated(); };
   /**
    * \brief This will return the preference for a given prey
    * \param i is the index of the prey
@@ -112,6 +112,12 @@ public:
    * \return biomass
    */
   double getBiomass(int area, int length) const { return biomass[this->areaNum(area)][length]; };
+  /**
+   * \brief This will return the biomass of prey that is available for consumption by predators
+   * \param area is the area that the prey consumption is being calculated on
+   * \return biomass, a DoubleVector containing the biomass for each length group
+   */
+  const DoubleVector& getBiomass(int area) const { return biomass[this->areaNum(area)]; };
   /**
    * \brief This will return the number of prey that is available for consumption by predators
    * \param area is the area that the consumption is being calculated on
@@ -0,0 +1,116 @@
+#ifndef profiler_h
+#define profiler_h
+
+#include "charptrvector.h"
+#include "doublevector.h"
+#include "gadget.h"
+
+/**
+ * \class Profiler
+ * \brief This is the class used to record the time spent in each part of the model simulation
+ *
+ * This class stores the total time that has been spent in each part (or entry) of the model simulation, accumulated over all the model runs.  Each entry has a type (eg. phase, stock or likelihood) and a name.  The timers are only used when the profiler is active, so that they cost almost nothing when the model simulation is not being profiled.
+ */
+class Profiler {
+public:
+  /**
+   * \brief This is the default Profiler constructor
+   */
+  Profiler();
+  /**
+   * \brief This is the default Profiler destructor
+   */
+  ~Profiler();
+  /**
+   * \brief This function will set whether the time spent in the model simulation should be recorded
+   * \param flag is the flag to denote whether the profiler is active
+   */
+  void setActive(int flag) { active = flag; };
+  /**
+   * \brief This function will return the flag used to denote whether the profiler is active
+   * \return active
+   */
+  int isActive() const { return active; };
+  /**
+   * \brief This function will add a new entry to the list of entries that are timed
+   * \param type is the type of the entry
+   * \param name is the name of the entry
+   * \return index of the new entry
+   */
+  int addEntry(const char* type, const char* name);
+  /**
+   * \brief This function will return the number of entries that are timed
+   * \return number of entries
+   */
+  int numEntries() const { return runtime.Size(); };
+  /**
+   * \brief This function will start a timer
+   * \return current time in seconds, or 0.0 if the profiler is not active
+   */
+  double startTimer() const { return (active ? getTime() : 0.0); };
+  /**
+   * \brief This function will stop a timer, and add the time taken to an entry
+   * \param id is the index of the entry
+   * \param start is the time returned by startTimer()
+   * \note The timers can be stopped by different threads at the same time, when parts of the model simulation are run at the same time
+   */
+  void stopTimer(int id, double start) { if (active) this->addTime(id, getTime() - start); };
+  /**
+   * \brief This function will increase the number of model runs that have been timed
+   */
+  void countRun() { if (active) numruns++; };
+  /**
+   * \brief This function will add the time recorded by another profiler with the same entries
+   * \param pro is the Profiler to add
+   */
+  void addProfile(const Profiler& pro);
+  /**
+   * \brief This function will write a summary table of the time spent in each entry to the log file
+   */
+  void Print() const;
+  /**
+   * \brief This function will write the time spent in each entry to a file
+   * \param filename is the name of the file to write the information to
+   */
+  void writeFile(const char* filename) const;
+private:
+  /**
+   * \brief This function will return the current time
+   * \return current time in seconds
+   */
+  static double getTime();
+  /**
+   * \brief This function will add time to an entry
+   * \param id is the index of the entry
+   * \param time is the time to be added, in seconds
+   */
+  void addTime(int id, double time);
+  /**
+   * \brief This is the CharPtrVector of the types of the entries
+   */
+  CharPtrVector types;
+  /**
+   * \brief This is the CharPtrVector of the names of the entries
+   */
+  CharPtrVector names;
+  /**
+   * \brief This is the DoubleVector of the total time spent in each entry, in seconds
+   */
+  DoubleVector runtime;
+  /**
+   * \brief This is the number of model runs that have been timed
+   */
+  int numruns;
+  /**
+   * \brief This is the flag used to denote whether the profiler is active
+   */
+  int active;
+#ifdef GADGET_THREADS
+  /**
+   * \brief This is the mutex used to protect the times when they are added by different threads
+   */
+  pthread_mutex_t timemutex;
+#endif
+};
+
+#endif
@@ -64,6 +64,14 @@ public:
    */
   int isRenewalStepArea(int area, const TimeClass* const TimeInfo);
 protected:
+  /**
+   * \brief This function will calculate the normal length distribution for one age group
+   * \param pop is the PopInfoIndexVector that the length distribution is stored in
+   * \param mean is the mean length of the age group
+   * \param mult is the inverse of the standard deviation of the length of the age group
+   * \return the sum of the length distribution
+   */
+  double calcNormalDistribution(PopInfoIndexVector& pop, double mean, double mult);
   /**
    * \brief This is the function used to read the normal distribution and condition factor for the renewal data
    * \param infile is the CommentStream to read the initial conditions data from
@@ -161,6 +169,14 @@ protected:
    * \brief This is the LengthGroupDivision of the renewal of the stock
    */
   LengthGroupDivision* LgrpDiv;
+  /**
+   * \brief This is the DoubleVector used to store the values when calculating a normal length distribution
+   */
+  DoubleVector normdist;
+  /**
+   * \brief This is the flag to denote whether any of the parameters used to calculate the renewal distributions have changed since the last model run
+   */
+  int parchanged;
 };
 
 #endif
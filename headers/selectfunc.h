@@ -51,6 +51,11 @@ public:
    * \return number
    */
   int numConstants() { return coeff.Size(); };
+  /**
+   * \brief This will return 1 if any of the selection function constants are based on the stock data, 0 otherwise
+   * \return flag
+   */
+  int usesStockData() const { return coeff.usesStockData(); };
 protected:
   /**
    * \brief This is the ModelVariableVector of the selection function constants
@@ -62,6 +62,11 @@ public:
    * \return 1 if the spawning process will take place, 0 otherwise
    */
   int isSpawnStepArea(int area, const TimeClass* const TimeInfo);
+  /**
+   * \brief This will return the stocks that the spawning process will create
+   * \return spawned stocks
+   */
+  const StockPtrVector& getSpawnStocks();
   /**
    * \brief This function will print the spawning information
    * \param outfile is the ofstream that all the model information gets sent to
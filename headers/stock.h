@@ -326,6 +326,11 @@ public:
    * \return straystocks, a StockPtrVector of the stocks that this stock will stray into
    */
   const StockPtrVector& getStrayStocks();
+  /**
+   * \brief This will return the stocks that this stock will spawn in to
+   * \return spawnstocks, a StockPtrVector of the stocks that this stock will spawn into
+   */
+  const StockPtrVector& getSpawnStocks();
   /**
    * \brief This function will add details for a new tagging experiment on the current stock
    * \param tagbyagelength is the AgeBandMatrixPtrVector of the new tagged population
@@ -411,6 +416,11 @@ protected:
    * \brief This is the NaturalMortality used to calculate information about the natural mortality of the stock
    */
   NaturalMortality* naturalm;
+  /**
+   * \brief This is the DoubleMatrix used to store the proportion surviving natural mortality on a substep
+   * \note This is kept as a class member so that no memory is allocated during the model simulation, with a separate row for each area so that the areas can be updated at the same time.  The indices for this object are [area][age]
+   */
+  DoubleMatrix propsurviving;
   /**
    * \brief This is the flag used to denote whether the stock will eat (ie. is a Predator) or not
    */
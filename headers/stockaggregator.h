@@ -6,6 +6,7 @@
 #include "stockptrvector.h"
 #include "conversionindexptrvector.h"
 #include "intmatrix.h"
+#include "aggregationplan.h"
 
 /**
  * \class StockAggregator
@@ -65,6 +66,10 @@ protected:
    * \brief This is the AgeBandMatrixPtrVector used to store the aggregated stock information
    */
   AgeBandMatrixPtrVector total;
+  /**
+   * \brief This is the AggregationPlan used to store the entries that are added together when aggregating the stocks
+   */
+  AggregationPlan plan;
   /**
    * \brief This is the AgeBandMatrix used to temporarily store information when aggregating the stocks
    */
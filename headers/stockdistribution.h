@@ -36,6 +36,12 @@ public:
    * \param TimeInfo is the TimeClass for the current model
    */
   virtual void addLikelihood(const TimeClass* const TimeInfo);
+  /**
+   * \brief This will return whether the likelihood score can only increase during a model simulation
+   * \return 1 for the sumofsquares likelihood function, 0 otherwise
+   * \note The multinomial likelihood function can be negative when the data are not whole numbers
+   */
+  virtual int isIncreasing() const { return (functionnumber == 2); };
   /**
    * \brief This function will reset the StockDistribution likelihood information
    * \param keeper is the Keeper for the current model
@@ -79,6 +85,13 @@ private:
    * \return likelihood score
    */
   double calcLikMultinomial();
+  /**
+   * \brief This function will calculate the terms of the multinomial function that only depend on the observed data
+   * \param numarea is the number of areas that the likelihood data covers
+   * \param numage is the number of age groups that the likelihood data covers
+   * \param numlen is the number of length groups that the likelihood data covers
+   */
+  void calcDataTerms(int numarea, int numage, int numlen);
   /**
    * \brief This function will calculate the likelihood score for the current timestep based on a sum of squares function
    * \param TimeInfo is the TimeClass for the current model
@@ -192,6 +205,19 @@ private:
    * \note This is set to zero, and not used, if the multinomial function is not used
    */
   Multinomial MN;
+  /**
+   * \brief This is the DoubleMatrix used to store the terms of the multinomial function that only depend on the observed data, if the multinomial function has been selected
+   * \note The indices for this object are [time][area * numage * numlen + id] where id = age+(numage*length)
+   */
+  DoubleMatrix dataterms;
+  /**
+   * \brief This is the DoubleVector used to store the observed stock distribution for one age-length group, if the multinomial function has been selected
+   */
+  DoubleVector obsdata;
+  /**
+   * \brief This is the DoubleVector used to store the modelled stock distribution for one age-length group, if the multinomial function has been selected
+   */
+  DoubleVector moddata;
   /**
    * \brief This is the AgeBandMatrixPtrVector used to temporarily store the information returned from the aggregatation function
    * \note The indices for this object are [area][age][length]
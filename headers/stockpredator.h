@@ -31,7 +31,7 @@ public:
   /**
    * \brief This is the default StockPredator destructor
    */
-  virtual ~StockPredator() {};
+  virtual ~StockPredator();
   /**
    * \brief This will calculate the amount the predator consumes on a given area
    * \param area is the area that the prey consumption is being calculated on
@@ -90,6 +90,12 @@ public:
    */
   const AgeBandMatrix& getCurrentALK(int area) const { return predAlkeys[this->areaNum(area)]; };
 protected:
+  /**
+   * \brief This function will calculate the product of the suitability and the energy content for each prey, if either has changed since they were last used on the area
+   * \param inarea is the internal area that the product is used on
+   * \note Each area keeps a separate copy of the product, so that the consumption on different areas can be calculated at the same time
+   */
+  void calcSuitEnergy(int inarea);
   /**
    * \brief This is the identifier of the function to be used to calculate the maximum consumption
    */
@@ -123,6 +129,21 @@ protected:
    * \note The indices for this object are [area][predator age][predator length]
    */
   AgeBandMatrixPtrVector predAlkeys;
+  /**
+   * \brief This is the DoubleMatrixPtrMatrix used to store the product of the suitability and the energy content of each prey
+   * \note The indices for this object are [area][prey][predator length][prey length]
+   */
+  DoubleMatrixPtrMatrix suitenergy;
+  /**
+   * \brief This is the DoubleMatrix of the energy content of each prey used when suitenergy was last calculated
+   * \note The indices for this object are [area][prey]
+   */
+  DoubleMatrix preyenergy;
+  /**
+   * \brief This is the IntVector of the number of times that the suitability values had been calculated when suitenergy was last calculated
+   * \note The indices for this object are [area]
+   */
+  IntVector suitcalc;
 };
 
 #endif
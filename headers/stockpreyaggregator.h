@@ -6,6 +6,8 @@
 #include "preyptrvector.h"
 #include "conversionindexptrvector.h"
 #include "intmatrix.h"
+#include "intvector.h"
+#include "aggregationplan.h"
 
 /**
  * \class StockPreyAggregator
@@ -65,6 +67,19 @@ protected:
    * \brief This is the AgeBandMatrixPtrVector used to store the aggregated stock prey information
    */
   AgeBandMatrixPtrVector total;
+  /**
+   * \brief This is the AggregationPlan used to store the entries that are added together when aggregating the preys
+   * \note There is one group in the plan for each prey and area that is to be aggregated
+   */
+  AggregationPlan plan;
+  /**
+   * \brief This is the IntVector used to store the index of the prey for each group in the plan
+   */
+  IntVector groupprey;
+  /**
+   * \brief This is the IntVector used to store the area for each group in the plan
+   */
+  IntVector grouparea;
   /**
    * \brief This is the AgeBandMatrix used to temporarily store information when aggregating the preys
    */
@@ -6,6 +6,7 @@
 #include "commentstream.h"
 #include "charptrvector.h"
 #include "stockptrvector.h"
+#include "keeper.h"
 
 /**
  * \class StockVariable
@@ -16,7 +17,7 @@ public:
   /**
    * \brief This is the default StockVariable constructor
    */
-  StockVariable() { value = 0.0; };
+  StockVariable() { value = 0.0; allstocks = 0; };
   /**
    * \brief This is the default StockVariable destructor
    */
@@ -24,8 +25,9 @@ public:
   /**
    * \brief This function will read StockVariable data from file
    * \param infile is the CommentStream to read the data from
+   * \param keeper is the Keeper for the current model
    */
-  void read(CommentStream& infile);
+  void read(CommentStream& infile, const Keeper* const keeper);
   /**
    * \brief This function will return the value of the StockVariable
    * \return the value of the StockVariable
@@ -62,6 +64,10 @@ private:
    * \brief This is the StockPtrVector of the stocks that will be used to calculate the StockVariable value
    */
   StockPtrVector stocks;
+  /**
+   * \brief This is the StockPtrVector of all the stocks for the current model, used to find the stocks that will be used to calculate the StockVariable value
+   */
+  const StockPtrVector* allstocks;
 };
 
 #endif
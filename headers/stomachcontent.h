@@ -231,6 +231,11 @@ protected:
    * \brief This is the DoubleVector used to temporarily store the modelled consumption when calculating the likelihood score
    */
   DoubleVector mndist;
+  /**
+   * \brief This is the DoubleMatrix used to store the terms of the multinomial function that only depend on the observed consumption
+   * \note The indices for this object are [time][area * number of prey + prey]
+   */
+  DoubleMatrix dataterms;
 };
 
 /**
@@ -401,6 +406,12 @@ public:
    * \param TimeInfo is the TimeClass for the current model
    */
   virtual void addLikelihood(const TimeClass* const TimeInfo);
+  /**
+   * \brief This will return whether the likelihood score can only increase during a model simulation
+   * \return 1 for the scratios, scamounts and scsimple functions, 0 otherwise
+   * \note The scnumbers function uses the multinomial likelihood function, which can be negative when the data are not whole numbers
+   */
+  virtual int isIncreasing() const;
   /**
    * \brief This function will reset the StomachContent likelihood information
    * \param keeper is the Keeper for the current model
@@ -5,6 +5,7 @@
 #include "hasname.h"
 #include "keeper.h"
 #include "modelvariablevector.h"
+#include "lengthgroup.h"
 
 /**
  * \class SuitFunc
@@ -17,7 +18,7 @@ public:
    * \brief This is the default SuitFunc constructor
    * \param givenname is the name for the SuitFunc selection function
    */
-  SuitFunc(const char* givenname) : HasName(givenname) {};
+  SuitFunc(const char* givenname) : HasName(givenname) { nanflag = 0; };
   /**
    * \brief This is the default SuitFunc destructor
    */
@@ -32,6 +33,7 @@ public:
    * \param infile is the CommentStream to read the parameters from
    * \param TimeInfo is the TimeClass for the current model
    * \param keeper is the Keeper for the current model
+   * \note This also registers the flag used to record any NaN found by the suitability function with the Keeper
    */
   void readConstants(CommentStream& infile, const TimeClass* const TimeInfo, Keeper* const keeper);
   /**
@@ -70,16 +72,39 @@ public:
    * \return 0 (will be overridden in derived classes)
    */
   virtual double calculate() = 0;
+  /**
+   * \brief This will calculate the suitability values for one predator length and each prey length group
+   * \param predlength is the predator length
+   * \param LgrpDiv is the LengthGroupDivision of the prey
+   * \param result is the DoubleVector that the suitability values are stored in, indexed by prey length group
+   * \note This will be overridden by the suitability functions that can calculate all the values in one batch
+   */
+  virtual void calculateVector(double predlength, const LengthGroupDivision* const LgrpDiv, DoubleVector& result);
   /**
    * \brief This will return the number of constants used to calculate the suitability value
    * \return number
    */
   int numConstants() { return coeff.Size(); };
+  /**
+   * \brief This will return 1 if any of the suitability function constants are based on the stock data, 0 otherwise
+   * \return flag
+   */
+  int usesStockData() const { return coeff.usesStockData(); };
+  /**
+   * \brief This will return 1 if a NaN has been found when calculating the suitability value during the current model run, 0 otherwise
+   * \return nanflag
+   */
+  int getNaNFlag() const { return nanflag; };
 protected:
   /**
    * \brief This is the ModelVariableVector of suitability function constants
    */
   ModelVariableVector coeff;
+  /**
+   * \brief This is the flag used to denote whether a NaN has been found when calculating the suitability value
+   * \note This flag is registered with the Keeper, which clears it at the start of each model run
+   */
+  int nanflag;
 };
 
 /**
@@ -121,7 +146,27 @@ public:
    * \return value
    */
   virtual double calculate();
+  /**
+   * \brief This will calculate the suitability values for one predator length and each prey length group
+   * \param predlength is the predator length
+   * \param LgrpDiv is the LengthGroupDivision of the prey
+   * \param result is the DoubleVector that the suitability values are stored in, indexed by prey length group
+   */
+  virtual void calculateVector(double predlength, const LengthGroupDivision* const LgrpDiv, DoubleVector& result);
 private:
+  /**
+   * \brief This will check that the suitability value is a number in the range 0.0 to 1.0
+   * \param check is the suitability value
+   * \return suitability value, or the nearest bound if it is out of range
+   */
+  double checkSuitability(double check);
+  /**
+   * \brief This will calculate the exponent used in the suitability function
+   * \param preylength is the prey length
+   * \param predlength is the predator length
+   * \return exponent
+   */
+  double calcExponent(double preylength, double predlength);
   /**
    * \brief This is the length of the prey
    */
@@ -247,7 +292,20 @@ public:
    * \return value
    */
   virtual double calculate();
+  /**
+   * \brief This will calculate the suitability values for one predator length and each prey length group
+   * \param predlength is the predator length
+   * \param LgrpDiv is the LengthGroupDivision of the prey
+   * \param result is the DoubleVector that the suitability values are stored in, indexed by prey length group
+   */
+  virtual void calculateVector(double predlength, const LengthGroupDivision* const LgrpDiv, DoubleVector& result);
 private:
+  /**
+   * \brief This will check that the suitability value is a number in the range 0.0 to 1.0
+   * \param check is the suitability value
+   * \return suitability value, or the nearest bound if it is out of range
+   */
+  double checkSuitability(double check);
   /**
    * \brief This is the length of the prey
    */
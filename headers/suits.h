@@ -17,7 +17,7 @@ public:
   /**
    * \brief This is the default Suits constructor
    */
-  Suits() {};
+  Suits() { parchanged = 1; nanfound = 0; calctime = 0; numcalc = 0; };
   /**
    * \brief This is the default Suits destructor
    */
@@ -69,6 +69,16 @@ public:
    * \param TimeInfo is the TimeClass for the current model
    */
   void Reset(const Predator* const pred, const TimeClass* const TimeInfo);
+  /**
+   * \brief This function will return the flag that the Keeper sets when the suitability parameters have changed
+   * \return pointer to the flag
+   */
+  int* getChangedFlag() { return &parchanged; };
+  /**
+   * \brief This function will return the number of times that the suitability values have been calculated, which can be used to check whether any values derived from them need to be recalculated
+   * \return number of calculations
+   */
+  int numCalculated() const { return numcalc; };
 protected:
   /**
    * \brief This is the CharPtrVector of prey names
@@ -83,6 +93,22 @@ protected:
    * \note The indices for this object are [prey][predator length][prey length]
    */
   DoubleMatrixPtrVector preCalcSuitability;
+  /**
+   * \brief This is the flag to denote whether any of the suitability parameters have changed since the last model run
+   */
+  int parchanged;
+  /**
+   * \brief This is the flag to denote whether a NaN was found when the suitability values were calculated on the first timestep of the last model run
+   */
+  int nanfound;
+  /**
+   * \brief This is the timestep that the suitability values were last calculated on
+   */
+  int calctime;
+  /**
+   * \brief This is the number of times that the suitability values have been calculated
+   */
+  int numcalc;
 };
 
 #endif
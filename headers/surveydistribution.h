@@ -40,6 +40,12 @@ public:
    * \param TimeInfo is the TimeClass for the current model
    */
   virtual void addLikelihood(const TimeClass* const TimeInfo);
+  /**
+   * \brief This will return whether the likelihood score can only increase during a model simulation
+   * \return 1 for the pearson and log likelihood functions, 0 otherwise
+   * \note The multinomial and gamma likelihood functions include log terms that can be negative
+   */
+  virtual int isIncreasing() const { return ((likenumber == 1) || (likenumber == 4)); };
   /**
    * \brief This function will reset the SurveyDistribution likelihood information
    * \param keeper is the Keeper for the current model
@@ -181,6 +187,11 @@ private:
    * \brief This is the DoubleMatrix used to store the calculated likelihood information
    */
   DoubleMatrix likelihoodValues;
+  /**
+   * \brief This is the DoubleMatrix used to store the total of the observed distribution for each timestep and area
+   * \note The observed data doesn't change, so this is calculated once when the data is read
+   */
+  DoubleMatrix obsTotal;
   /**
    * \brief This is the index of the timesteps for the likelihood component data
    */
@@ -35,6 +35,11 @@ public:
    * \param TimeInfo is the TimeClass for the current model
    */
   virtual void addLikelihood(const TimeClass* const TimeInfo);
+  /**
+   * \brief This will return whether the likelihood score can only increase during a model simulation
+   * \return 1, since the score is a sum of squares from the fitted regression lines
+   */
+  virtual int isIncreasing() const { return 1; };
   /**
    * \brief This will select the fleets and stocks required to calculate the SurveyIndices likelihood score
    * \param Fleets is the FleetPtrVector of all the available fleets
@@ -0,0 +1,109 @@
+#ifndef threadpool_h
+#define threadpool_h
+
+#include "gadget.h"
+
+/**
+ * \brief This is the type of the functions that can be run as tasks by the ThreadPool
+ * \param data is a pointer to the object that the tasks are run for
+ * \param task is the index of the task that is to be run
+ */
+typedef void (*ThreadTask)(void* data, int task);
+
+/**
+ * \class ThreadPool
+ * \brief This is the class used to run a number of independent tasks at the same time during the model simulation
+ * \note The threads are started once and then wait until they are given a set of tasks to run.  The tasks are handed out one at a time to the first thread that is free, including the thread that gave the tasks to the pool, and the pool only returns once all the tasks have been completed.  If Gadget has been compiled without thread support then the tasks are run in order by the calling thread
+ */
+class ThreadPool {
+public:
+  /**
+   * \brief This is the default ThreadPool constructor
+   */
+  ThreadPool();
+  /**
+   * \brief This is the default ThreadPool destructor
+   * \note This will stop any threads that have been started
+   */
+  ~ThreadPool();
+  /**
+   * \brief This function will start the threads used to run the tasks
+   * \param num is the total number of threads that will run the tasks, including the calling thread
+   */
+  void startThreads(int num);
+  /**
+   * \brief This function will return the total number of threads that will run the tasks
+   * \return number of threads
+   */
+  int numThreads() const { return numthreads; };
+  /**
+   * \brief This function will run a set of tasks, and return once they have all been completed
+   * \param func is the ThreadTask function that will be run for each task
+   * \param data is the pointer that will be given to func
+   * \param numtasks is the number of tasks, which will be run with task indices from 0 to numtasks - 1
+   */
+  void Run(ThreadTask func, void* data, int numtasks);
+private:
+  /**
+   * \brief This is the number of threads that will run the tasks, including the calling thread
+   */
+  int numthreads;
+#ifdef GADGET_THREADS
+  /**
+   * \brief This function will run the tasks that have not yet been started until there are none left
+   * \note This function must be called with the mutex locked, and will return with the mutex locked
+   */
+  void runTasks();
+  /**
+   * \brief This is the function used as the entry point for the threads in the pool
+   * \param pool is the ThreadPool that the thread belongs to
+   */
+  static void* runThread(void* pool);
+  /**
+   * \brief This is the array of the threads that have been started
+   */
+  pthread_t* threads;
+  /**
+   * \brief This is the mutex used to protect the information about the current set of tasks
+   */
+  pthread_mutex_t mutex;
+  /**
+   * \brief This is the condition used to tell the threads that a new set of tasks is ready
+   */
+  pthread_cond_t taskready;
+  /**
+   * \brief This is the condition used to tell the calling thread that all the tasks have been completed
+   */
+  pthread_cond_t taskdone;
+  /**
+   * \brief This is the ThreadTask function for the current set of tasks
+   */
+  ThreadTask taskfunc;
+  /**
+   * \brief This is the pointer given to the ThreadTask function for the current set of tasks
+   */
+  void* taskdata;
+  /**
+   * \brief This is the number of tasks in the current set of tasks
+   */
+  int numtasks;
+  /**
+   * \brief This is the index of the next task that will be started
+   */
+  int nexttask;
+  /**
+   * \brief This is the number of tasks that have been completed
+   */
+  int numdone;
+  /**
+   * \brief This is the counter used to identify each new set of tasks
+   */
+  int generation;
+  /**
+   * \brief This is the flag used to denote whether the threads should stop
+   */
+  int stopping;
+#endif
+};
+
+#endif
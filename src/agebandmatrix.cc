@@ -9,11 +9,18 @@ AgeBandMatrix::AgeBandMatrix(const AgeBandMatrix& initial)
 
   int i;
   if (nrow > 0) {
-    v = new PopInfoIndexVector*[nrow];
-    for (i = 0; i < nrow; i++)
-      v[i] = new PopInfoIndexVector(initial[i + minage]);
-  } else
+    IntVector minl(nrow, 0), size(nrow, 0);
+    for (i = 0; i < nrow; i++) {
+      minl[i] = initial.minLength(i + minage);
+      size[i] = initial[i + minage].Size();
+    }
+    this->allocate(minl, size);
+    for (i = 0; i < ageoffset[nrow]; i++)
+      store[i] = initial.store[i];
+  } else {
     v = 0;
+    store = 0;
+  }
 }
 
 AgeBandMatrix::AgeBandMatrix(int age, const IntVector& minl,
@@ -22,11 +29,13 @@ AgeBandMatrix::AgeBandMatrix(int age, const IntVector& minl,
   int i;
   if (nrow > 0) {
     PopInfo nullpop;
-    v = new PopInfoIndexVector*[nrow];
-    for (i = 0; i < nrow; i++)
-      v[i] = new PopInfoIndexVector(size[i], minl[i], nullpop);
-  } else
+    this->allocate(minl, size);
+    for (i = 0; i < ageoffset[nrow]; i++)
+      store[i] = nullpop;
+  } else {
     v = 0;
+    store = 0;
+  }
 }
 
 AgeBandMatrix::AgeBandMatrix(int age, const PopInfoMatrix& initial, int minl)
@@ -34,7 +43,7 @@ AgeBandMatrix::AgeBandMatrix(int age, const PopInfoMatrix& initial, int minl)
 
   if (nrow > 0) {
     int i, j, lower, upper;
-    v = new PopInfoIndexVector*[nrow];
+    IntVector lowerl(nrow, 0), size(nrow, 0);
     for (i = 0; i < nrow; i++) {
       lower = 0;
       upper = initial.Ncol(i) - 1;
@@ -42,27 +51,51 @@ AgeBandMatrix::AgeBandMatrix(int age, const PopInfoMatrix& initial, int minl)
         lower++;
       while (isZero(initial[i][upper].N) && (upper > lower))
         upper--;
-      v[i] = new PopInfoIndexVector(upper - lower + 1, lower + minl);
-      for (j = lower; j <= upper; j++)
-        (*v[i])[j + minl] = initial[i][j];
+      lowerl[i] = lower + minl;
+      size[i] = upper - lower + 1;
     }
-  } else
+    this->allocate(lowerl, size);
+    for (i = 0; i < nrow; i++)
+      for (j = lowerl[i]; j < lowerl[i] + size[i]; j++)
+        v[i][j] = initial[i][j - minl];
+  } else {
     v = 0;
+    store = 0;
+  }
 }
 
 AgeBandMatrix::AgeBandMatrix(int age, const PopInfoIndexVector& initial)
   : minage(age), nrow(1) {
 
-  v = new PopInfoIndexVector*[nrow];
-  v[0] = new PopInfoIndexVector(initial);
+  int i;
+  IntVector minl(1, initial.minCol()), size(1, initial.Size());
+  this->allocate(minl, size);
+  for (i = initial.minCol(); i < initial.maxCol(); i++)
+    v[0][i] = initial[i];
 }
 
 AgeBandMatrix::~AgeBandMatrix() {
-  int i;
   if (v != 0) {
-    for (i = 0; i < nrow; i++)
-      delete v[i];
     delete[] v;
     v = 0;
   }
+  if (store != 0) {
+    delete[] store;
+    store = 0;
+  }
+}
+
+void AgeBandMatrix::allocate(const IntVector& minl, const IntVector& size) {
+  int i;
+  ageoffset.resize(nrow + 1, 0);
+  for (i = 0; i < nrow; i++)
+    ageoffset[i + 1] = ageoffset[i] + (size[i] > 0 ? size[i] : 0);
+
+  v = new PopInfoIndexVector[nrow];
+  if (ageoffset[nrow] > 0)
+    store = new PopInfo[ageoffset[nrow]];
+  else
+    store = 0;
+  for (i = 0; i < nrow; i++)
+    v[i].setStore(size[i], minl[i], store + ageoffset[i]);
 }
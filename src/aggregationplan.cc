@@ -0,0 +1,124 @@
+#include "aggregationplan.h"
+#include "mathfunc.h"
+#include "gadget.h"
+#include "global.h"
+
+AggregationPlan::~AggregationPlan() {
+  if (maxsize > 0) {
+    delete[] dest;
+    delete[] source;
+    delete[] ratioindex;
+    delete[] numpos;
+  }
+}
+
+int AggregationPlan::addGroup() {
+  groupstart.resize(1, size);
+  return (groupstart.Size() - 1);
+}
+
+void AggregationPlan::addEntry(PopInfo* d, const PopInfo* s, int r, int n) {
+  int i;
+  if (size == maxsize) {
+    //the plan is only created once, so grow the arrays in large steps
+    maxsize = (maxsize > 0 ? 2 * maxsize : 64);
+    PopInfo** newdest = new PopInfo*[maxsize];
+    const PopInfo** newsource = new const PopInfo*[maxsize];
+    int* newratioindex = new int[maxsize];
+    int* newnumpos = new int[maxsize];
+    for (i = 0; i < size; i++) {
+      newdest[i] = dest[i];
+      newsource[i] = source[i];
+      newratioindex[i] = ratioindex[i];
+      newnumpos[i] = numpos[i];
+    }
+    if (size > 0) {
+      delete[] dest;
+      delete[] source;
+      delete[] ratioindex;
+      delete[] numpos;
+    }
+    dest = newdest;
+    source = newsource;
+    ratioindex = newratioindex;
+    numpos = newnumpos;
+  }
+
+  dest[size] = d;
+  source[size] = s;
+  ratioindex[size] = r;
+  numpos[size] = n;
+  size++;
+}
+
+void AggregationPlan::addEntries(PopInfoIndexVector& Total,
+  const PopInfoIndexVector& Addition, const ConversionIndex& CI) {
+
+  //a negative size means that there is no limit from the multiplicative constants
+  this->addEntries(Total, Addition, CI, -1);
+}
+
+void AggregationPlan::addEntries(PopInfoIndexVector& Total,
+  const PopInfoIndexVector& Addition, const ConversionIndex& CI, int ratiosize) {
+
+  int l, minl, maxl, offset;
+
+  //the entries are found in the same way as in PopInfoIndexVector::Add
+  if (CI.isSameDl()) {
+    offset = CI.getOffset();
+    minl = max(Total.minCol(), Addition.minCol() + offset);
+    maxl = min(Total.maxCol(), Addition.maxCol() + offset);
+    if ((ratiosize >= 0) && (maxl > ratiosize + offset))
+      maxl = ratiosize + offset;
+    for (l = minl; l < maxl; l++)
+      this->addEntry(&Total[l], &Addition[l - offset], l - offset, 1);
+
+  } else {
+    if (CI.isFiner()) {
+      minl = max(Total.minCol(), CI.minPos(Addition.minCol()));
+      maxl = min(Total.maxCol(), CI.maxPos(Addition.maxCol() - 1) + 1);
+      for (l = minl; l < maxl; l++)
+        this->addEntry(&Total[l], &Addition[CI.getPos(l)], CI.getPos(l), CI.getNumPos(l));
+
+    } else {
+      minl = max(CI.minPos(Total.minCol()), Addition.minCol());
+      maxl = min(CI.maxPos(Total.maxCol() - 1) + 1, Addition.maxCol());
+      if ((ratiosize >= 0) && (maxl > ratiosize))
+        maxl = ratiosize;
+      for (l = minl; l < maxl; l++)
+        this->addEntry(&Total[CI.getPos(l)], &Addition[l], l, 1);
+    }
+  }
+}
+
+void AggregationPlan::Sum(int group, double ratio) const {
+  if (isZero(ratio))
+    return;
+
+  int i, end;
+  PopInfo pop;
+  end = (group < groupstart.Size() - 1 ? groupstart[group + 1] : size);
+  for (i = groupstart[group]; i < end; i++) {
+    pop = *source[i];
+    pop *= ratio;
+    *dest[i] += pop;
+    if (numpos[i] != 1)
+      dest[i]->N /= numpos[i];  //numpos should never be zero
+  }
+}
+
+void AggregationPlan::Sum(int group, const DoubleVector& Ratio, double ratio) const {
+  if (isZero(ratio))
+    return;
+
+  int i, end;
+  PopInfo pop;
+  end = (group < groupstart.Size() - 1 ? groupstart[group + 1] : size);
+  for (i = groupstart[group]; i < end; i++) {
+    pop = *source[i];
+    pop *= (ratio * Ratio[ratioindex[i]]);
+    *dest[i] += pop;
+    if (numpos[i] != 1)
+      dest[i]->N /= numpos[i];  //numpos should never be zero
+  }
+}
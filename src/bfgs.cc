@@ -10,8 +10,6 @@
 /* This means that the function has been replaced by a call to ecosystem */
 /* object, and we can use the vector objects that have been defined      */
 
-extern Ecosystem* EcoSystem;
-
 /* calculate the smallest eigenvalue of a matrix */
 double OptInfoBFGS::getSmallestEigenValue(DoubleMatrix M) {
 
@@ -84,23 +82,43 @@ double OptInfoBFGS::getSmallestEigenValue(DoubleMatrix M) {
 /* by J E Dennis and Robert B Schnabel, published by SIAM, 1996             */
 void OptInfoBFGS::gradient(DoubleVector& point, double pointvalue, DoubleVector& newgrad) {
 
-  double ftmp, tmpacc;
-  int i, j;
+  double tmpacc;
+  int i, j, central;
   int nvars = point.Size();
-  DoubleVector gtmp(point);
 
+  //JMB the scaled parameter values should aways be positive
+  for (i = 0; i < nvars; i++)
+    if (point[i] < 0.0)
+      handle.logMessage(LOGINFO, "Error in BFGS - negative parameter when calculating the gradient", point[i]);
+
+  //use central differences once the gradient accuracy has been reduced enough
+  central = 0;
+  if ((gradcentral > 0.0) && (gradacc < gradcentral))
+    central = 1;
+
+  //the perturbed points are evaluated as one batch, so they can be run at the same time
+  DoubleMatrix gtmp((central + 1) * nvars, nvars, 0.0);
+  DoubleVector ftmp((central + 1) * nvars, 0.0);
   for (i = 0; i < nvars; i++) {
     for (j = 0; j < nvars; j++)
-      gtmp[j] = point[j];
+      gtmp[i][j] = point[j];
+    tmpacc = gradacc * max(point[i], 1.0);
+    gtmp[i][i] += tmpacc;
 
-    //JMB the scaled parameter values should aways be positive
-    if (point[i] < 0.0)
-      handle.logMessage(LOGINFO, "Error in BFGS - negative parameter when calculating the gradient", point[i]);
+    if (central) {
+      for (j = 0; j < nvars; j++)
+        gtmp[nvars + i][j] = point[j];
+      gtmp[nvars + i][i] -= tmpacc;
+    }
+  }
 
+  EcoSystem->SimulateAndUpdate(gtmp, ftmp);
+  for (i = 0; i < nvars; i++) {
     tmpacc = gradacc * max(point[i], 1.0);
-    gtmp[i] += tmpacc;
-    ftmp = EcoSystem->SimulateAndUpdate(gtmp);
-    newgrad[i] = (ftmp - pointvalue) / tmpacc;
+    if (central)
+      newgrad[i] = (ftmp[i] - ftmp[nvars + i]) / (2.0 * tmpacc);
+    else
+      newgrad[i] = (ftmp[i] - pointvalue) / tmpacc;
   }
 }
 
@@ -111,6 +129,8 @@ void OptInfoBFGS::OptimiseLikelihood() {
   int i, j, resetgrad, offset, armijo;
 
   handle.logMessage(LOGINFO, "\nStarting BFGS optimisation algorithm\n");
+  if (threads > 1)
+    handle.logMessage(LOGINFO, "Calculating the gradient using", threads, "threads");
   int nvars = EcoSystem->numOptVariables();
   DoubleVector x(nvars);
   DoubleVector trialx(nvars);
@@ -46,7 +46,7 @@ BoundLikelihood::BoundLikelihood(CommentStream& infile, const AreaClass* const A
 void BoundLikelihood::Reset(const Keeper* const keeper) {
 
   Likelihood::Reset(keeper);
-  handle.setNaNFlag(0);  // reset the NaN count
+  keeper->clearNaNFlags();  // reset the NaN count
   if (isZero(weight))
     handle.logMessage(LOGWARN, "Warning in boundlikelihood - zero weight for", this->getName());
 
@@ -167,7 +167,7 @@ void BoundLikelihood::addLikelihoodKeeper(const TimeClass* const TimeInfo, Keepe
   if ((handle.getLogLevel() >= LOGMESSAGE) && (isZero(likelihood)))
     handle.logMessage(LOGMESSAGE, "For this model simulation, no parameters are outside the bounds");
 
-  if (handle.getNaNFlag()) {
+  if (keeper->getNaNFlag()) {
     likelihood += verybig;
     if (handle.getLogLevel() >= LOGMESSAGE)
       handle.logMessage(LOGMESSAGE, "For this model simulation, a NaN was found within the model");
@@ -177,6 +177,14 @@ void BoundLikelihood::addLikelihoodKeeper(const TimeClass* const TimeInfo, Keepe
     handle.logMessage(LOGMESSAGE, "Calculated likelihood score for boundlikelihood component to be", likelihood);
 }
 
+int BoundLikelihood::isIncreasing() const {
+  int i;
+  for (i = 0; i < lowerweights.Size(); i++)
+    if ((lowerweights[i] < 0.0) || (upperweights[i] < 0.0))
+      return 0;
+  return 1;
+}
+
 void BoundLikelihood::printSummary(ofstream& outfile) {
   //JMB there is only one likelihood score here ...
   if (!(isZero(likelihood))) {
@@ -140,6 +140,8 @@ CatchDistribution::CatchDistribution(CommentStream& infile, const AreaClass* con
   handle.Close();
   datafile.close();
   datafile.clear();
+  agedist.resize(numage, 0.0);
+  agedata.resize(numage, 0.0);
 
   //read in length aggregation from file
   readWordAndValue(infile, "lenaggfile", aggfilename);
@@ -222,6 +224,33 @@ CatchDistribution::CatchDistribution(CommentStream& infile, const AreaClass* con
       handle.logMessage(LOGWARN, "Warning in catchdistribution - unrecognised function", functionname);
       break;
   }
+
+  if (functionnumber == 1)
+    this->calcDataTerms(numarea, numage, numlen);
+}
+
+void CatchDistribution::calcDataTerms(int numarea, int numage, int numlen) {
+  int i, area, age, len;
+
+  //the observed data doesn't change, so the terms that only depend on it are calculated once
+  if (numage == 1) {
+    dataterms.AddRows(obsDistribution.Nrow(), numarea, 0.0);
+    for (i = 0; i < obsDistribution.Nrow(); i++)
+      for (area = 0; area < numarea; area++)
+        dataterms[i][area] = MN.calcDataTerm((*obsDistribution[i][area])[0]);
+
+  } else {
+    dataterms.AddRows(obsDistribution.Nrow(), numarea * numlen, 0.0);
+    for (i = 0; i < obsDistribution.Nrow(); i++) {
+      for (area = 0; area < numarea; area++) {
+        for (len = 0; len < numlen; len++) {
+          for (age = 0; age < numage; age++)
+            agedata[age] = (*obsDistribution[i][area])[age][len];
+          dataterms[i][area * numlen + len] = MN.calcDataTerm(agedata);
+        }
+      }
+    }
+  }
 }
 
 void CatchDistribution::readDistributionData(CommentStream& infile,
@@ -620,8 +649,6 @@ double CatchDistribution::calcLikMultinomial() {
   int area, age, len;
   int numage = ages.Nrow();
   int numlen = LgrpDiv->numLengthGroups();
-  DoubleVector dist(numage, 0.0);
-  DoubleVector data(numage, 0.0);
 
   MN.Reset();
   //the object MN does most of the work, accumulating likelihood
@@ -635,16 +662,17 @@ double CatchDistribution::calcLikMultinomial() {
       //only one age-group, so calculate multinomial based on length distribution
       likelihoodValues[timeindex][area] +=
         MN.calcLogLikelihood((*obsDistribution[timeindex][area])[0],
-          (*modelDistribution[timeindex][area])[0]);
+          (*modelDistribution[timeindex][area])[0], dataterms[timeindex][area]);
 
     } else {
       //many age-groups, so calculate multinomial based on age distribution per length group
       for (len = 0; len < numlen; len++) {
         for (age = 0; age < numage; age++) {
-          dist[age] = (*modelDistribution[timeindex][area])[age][len];
-          data[age] = (*obsDistribution[timeindex][area])[age][len];
+          agedist[age] = (*modelDistribution[timeindex][area])[age][len];
+          agedata[age] = (*obsDistribution[timeindex][area])[age][len];
         }
-        likelihoodValues[timeindex][area] += MN.calcLogLikelihood(data, dist);
+        likelihoodValues[timeindex][area] += MN.calcLogLikelihood(agedata, agedist,
+          dataterms[timeindex][area * numlen + len]);
       }
     }
   }
@@ -0,0 +1,266 @@
+#include "ecosystem.h"
+#include "farmfunc.h"
+#include "errorhandler.h"
+#include "gadget.h"
+#include "global.h"
+
+#ifdef NOT_WINDOWS
+
+void Ecosystem::chooseCheckpoints() {
+  int i, j, k, tmp;
+  IntVector first;
+
+  //only the parameters that are optimised will change between model runs
+  checksteps.Reset();
+  for (i = 0; i < optflag.Size(); i++) {
+    if ((optflag[i]) && (keeper->getFirstUse(i) > 1)) {
+      k = first.Size();
+      first.resize(1, keeper->getFirstUse(i));
+      while ((k > 0) && (first[k] < first[k - 1])) {
+        tmp = first[k];
+        first[k] = first[k - 1];
+        first[k - 1] = tmp;
+        k--;
+      }
+    }
+  }
+
+  //share the snapshots between the timesteps that the parameters are first used on
+  for (i = 0; i < numcheckpoints && i < first.Size(); i++) {
+    j = (i * first.Size()) / numcheckpoints;
+    if ((checksteps.Size() == 0) || (checksteps[checksteps.Size() - 1] != first[j]))
+      checksteps.resize(1, first[j]);
+  }
+}
+
+void Ecosystem::startTrace() {
+  this->chooseCheckpoints();
+  keeper->startTrace();
+}
+
+void Ecosystem::stopTrace() {
+  keeper->stopTrace();
+}
+
+void Ecosystem::checkpointStep(int step) {
+  int i, j, pid;
+  int fds[2];
+
+  keeper->setTraceStep(step);
+  for (i = 0; i < checksteps.Size(); i++)
+    if (checksteps[i] == step)
+      break;
+  if (i == checksteps.Size())
+    return;
+
+  //a snapshot that has died should be reported as a warning, not kill Gadget
+  signal(SIGPIPE, SIG_IGN);
+  if (socketpair(AF_UNIX, SOCK_STREAM, 0, fds) != 0) {
+    handle.logMessage(LOGWARN, "Warning in ecosystem - failed to create socket for snapshot on timestep", step);
+    return;
+  }
+
+  pid = fork();
+  if (pid < 0) {
+    handle.logMessage(LOGWARN, "Warning in ecosystem - failed to create snapshot on timestep", step);
+    close(fds[0]);
+    close(fds[1]);
+    return;
+  }
+
+  if (pid == 0) {
+    //this is the process that keeps the snapshot, which only needs its own connection
+    close(fds[0]);
+    for (j = 0; j < checkfd.Size(); j++)
+      close(checkfd[j]);
+    for (j = 0; j < farmfd.Size(); j++)
+      close(farmfd[j]);
+    signal(SIGINT, SIG_IGN);
+    handle.setLogLevel(LOGFAIL);
+    isworker = 1;
+    checkcapture = 0;
+    this->stopTrace();
+
+    //this only returns in the process that resumes the simulation from the snapshot
+    this->holdCheckpoint(fds[1]);
+    return;
+  }
+
+  close(fds[1]);
+  checkfd.resize(1, fds[0]);
+  checkpid.resize(1, pid);
+  checkstep.resize(1, step);
+  checkgen.resize(1, checkvalues.Nrow());
+}
+
+void Ecosystem::holdCheckpoint(int fd) {
+  int i, tag, id, pid, status;
+  DoubleVector val(keeper->numVariables(), 0.0);
+
+  while (farmReadInt(fd, tag) && (tag == FARMSIMULATE)) {
+    if (!farmReadInt(fd, id) || !farmReadVector(fd, val))
+      break;
+
+    //the snapshot is copied for each request, so it can be used again
+    pid = fork();
+    if (pid == 0) {
+      keeper->Update(val);
+      //the bound likelihood is calculated from the values before the first timestep
+      for (i = 0; i < likevec.Size(); i++) {
+        if (likevec[i]->getType() == BOUNDLIKELIHOOD) {
+          likevec[i]->Reset(keeper);
+          likevec[i]->addLikelihoodKeeper(TimeInfo, keeper);
+        }
+      }
+      checkreply = fd;
+      checkid = id;
+      return;
+    }
+
+    status = -1;
+    if (pid > 0)
+      waitpid(pid, &status, 0);
+    if ((pid < 0) || (!WIFEXITED(status)) || (WEXITSTATUS(status) != EXIT_SUCCESS))
+      if (!farmWriteInt(fd, -1))  //let the model know that the simulation failed
+        break;
+  }
+
+  close(fd);
+  _exit(EXIT_SUCCESS);  //dont run the destructors, since they belong to the model
+}
+
+void Ecosystem::finishResume() {
+  int i;
+  DoubleVector val(keeper->numVariables(), 0.0);
+  DoubleVector likes(likevec.Size(), 0.0);
+
+  keeper->getCurrentValues(val);
+  for (i = 0; i < likevec.Size(); i++)
+    likes[i] = likevec[i]->getUnweightedLikelihood();
+
+  if (!farmWriteInt(checkreply, checkid) || !farmWriteDouble(checkreply, likelihood)
+      || !farmWriteVector(checkreply, likes) || !farmWriteVector(checkreply, val))
+    _exit(EXIT_FAILURE);
+  _exit(EXIT_SUCCESS);
+}
+
+int Ecosystem::resumeSimulation(const DoubleVector& val) {
+  int i, j, g, first, best, id, check;
+
+  //find the latest snapshot that is before any of the changes to the parameters are used
+  best = -1;
+  for (g = 0; g < checkvalues.Nrow(); g++) {
+    first = TimeInfo->numTotalSteps() + 1;
+    for (i = 0; i < val.Size(); i++)  //any change to the value must be simulated, however small
+      if ((val[i] != checkvalues[g][i]) && (keeper->getFirstUse(i) < first))
+        first = keeper->getFirstUse(i);
+
+    for (j = 0; j < checkfd.Size(); j++)
+      if ((checkgen[j] == g) && (checkstep[j] <= first) && ((best < 0) || (checkstep[j] > checkstep[best])))
+        best = j;
+  }
+  if (best < 0)
+    return 0;
+
+  if (checklikes.Size() == 0)
+    checklikes.resize(likevec.Size(), 0.0);
+  if (checkval.Size() == 0)
+    checkval.resize(val.Size(), 0.0);
+
+  check = farmWriteInt(checkfd[best], FARMSIMULATE) && farmWriteInt(checkfd[best], funceval) && farmWriteVector(checkfd[best], val);
+  check = check && farmReadInt(checkfd[best], id) && (id == funceval);
+  check = check && farmReadDouble(checkfd[best], likelihood) && farmReadVector(checkfd[best], checklikes);
+  check = check && farmReadVector(checkfd[best], checkval);
+  if (!check) {
+    handle.logMessage(LOGWARN, "Warning in ecosystem - failed to resume simulation from snapshot on timestep", checkstep[best]);
+    handle.logMessage(LOGWARN, "Warning in ecosystem - no more snapshots of the model will be used");
+    this->stopCheckpoints();
+    numcheckpoints = 0;
+    return 0;
+  }
+
+  //the values can have been changed by the bound likelihood
+  keeper->Update(checkval);
+  return 1;
+}
+
+void Ecosystem::updateCheckpoints(const DoubleVector& val) {
+  int i, g, gen, drop;
+
+  //the snapshots from the last model run are only used if any were taken
+  gen = checkvalues.Nrow();
+  for (i = 0; i < checkgen.Size(); i++)
+    if (checkgen[i] == gen)
+      break;
+  if (i == checkgen.Size())
+    return;
+
+  checkvalues.AddRows(1, val.Size(), 0.0);
+  checkvalues[gen] = val;
+  checkscore.resize(1, likelihood);
+
+  //keep the snapshots from the last model run and from the best model run
+  while (checkvalues.Nrow() > 2) {
+    drop = 0;
+    for (g = 1; g < checkvalues.Nrow() - 1; g++)
+      if (checkscore[g] > checkscore[drop])
+        drop = g;
+    this->stopCheckpoints(drop);
+  }
+}
+
+void Ecosystem::stopCheckpoints(int gen) {
+  int i, status;
+  for (i = checkfd.Size() - 1; i >= 0; i--) {
+    if ((gen < 0) || (checkgen[i] == gen)) {
+      farmWriteInt(checkfd[i], FARMSTOP);
+      close(checkfd[i]);
+      waitpid(checkpid[i], &status, 0);
+      checkfd.Delete(i);
+      checkpid.Delete(i);
+      checkstep.Delete(i);
+      checkgen.Delete(i);
+    } else if (checkgen[i] > gen)
+      checkgen[i]--;
+  }
+
+  if (gen < 0) {
+    checkvalues.Reset();
+    checkscore.Reset();
+  } else {
+    checkvalues.Delete(gen);
+    checkscore.Delete(gen);
+  }
+}
+
+#else
+
+void Ecosystem::chooseCheckpoints() {
+}
+
+void Ecosystem::startTrace() {
+}
+
+void Ecosystem::stopTrace() {
+}
+
+void Ecosystem::checkpointStep(int step) {
+}
+
+void Ecosystem::holdCheckpoint(int fd) {
+}
+
+void Ecosystem::finishResume() {
+}
+
+int Ecosystem::resumeSimulation(const DoubleVector& val) {
+  return 0;
+}
+
+void Ecosystem::updateCheckpoints(const DoubleVector& val) {
+}
+
+void Ecosystem::stopCheckpoints(int gen) {
+}
+
+#endif
@@ -3,30 +3,56 @@
 #include "gadget.h"
 
 DoubleMatrix::DoubleMatrix(int nr, int nc, double value) {
-  nrow = nr;
-  v = new DoubleVector*[nr];
+  nrow = 0;
+  v = 0;
+  store = 0;
   int i, j;
-  for (i = 0; i < nr; i++)
-    v[i] = new DoubleVector(nc);
-  for (i = 0; i < nr; i++) {
-    for (j = 0; j < nc; j++)
-      (*v[i])[j] = value;
+  if (nr > 0) {
+    IntVector size(nr, nc);
+    this->allocate(size);
+    for (i = 0; i < nrow; i++)
+      for (j = 0; j < nc; j++)
+        (*v[i])[j] = value;
   }
 }
 
-DoubleMatrix::DoubleMatrix(const DoubleMatrix& initial) : nrow(initial.nrow) {
-  int i;
-  if (nrow >= 0) {
-    v = new DoubleVector*[nrow];
+DoubleMatrix::DoubleMatrix(const DoubleMatrix& initial) {
+  nrow = 0;
+  v = 0;
+  store = 0;
+  int i, j;
+  if (initial.nrow > 0) {
+    IntVector size(initial.nrow, 0);
+    for (i = 0; i < initial.nrow; i++)
+      size[i] = initial[i].Size();
+    this->allocate(size);
     for (i = 0; i < nrow; i++)
-      v[i] = new DoubleVector(initial[i]);
-  } else {
-    v = 0;
-    nrow = 0;
+      for (j = 0; j < size[i]; j++)
+        (*v[i])[j] = initial[i][j];
   }
 }
 
 DoubleMatrix::~DoubleMatrix() {
+  this->freeStore();
+}
+
+void DoubleMatrix::allocate(const IntVector& size) {
+  int i, total;
+  nrow = size.Size();
+  v = new DoubleVector*[nrow];
+  total = 0;
+  for (i = 0; i < nrow; i++)
+    total += (size[i] > 0 ? size[i] : 0);
+
+  store = (total > 0 ? new double[total] : 0);
+  total = 0;
+  for (i = 0; i < nrow; i++) {
+    v[i] = new DoubleVector(size[i], store + total);
+    total += (size[i] > 0 ? size[i] : 0);
+  }
+}
+
+void DoubleMatrix::freeStore() {
   int i;
   if (v != 0) {
     for (i = 0; i < nrow; i++)
@@ -34,20 +60,27 @@ DoubleMatrix::~DoubleMatrix() {
     delete[] v;
     v = 0;
   }
+  if (store != 0) {
+    delete[] store;
+    store = 0;
+  }
+  nrow = 0;
 }
 
 void DoubleMatrix::AddRows(int add, int length, double value) {
   if (add <= 0)
     return;
 
-  int i;
+  int i, j;
   if (v == 0) {
-   nrow = add;
-   v = new DoubleVector*[nrow];
-   for (i = 0; i < nrow; i++)
-     v[i] = new DoubleVector(length, value);
+    IntVector size(add, length);
+    this->allocate(size);
+    for (i = 0; i < nrow; i++)
+      for (j = 0; j < length; j++)
+        (*v[i])[j] = value;
 
   } else {
+    //rows added to an existing vector use their own memory
     DoubleVector** vnew = new DoubleVector*[nrow + add];
     for (i = 0; i < nrow; i++)
       vnew[i] = v[i];
@@ -75,38 +108,44 @@ void DoubleMatrix::Delete(int pos) {
     delete[] v;
     v = 0;
     nrow = 0;
+    if (store != 0) {
+      delete[] store;
+      store = 0;
+    }
   }
 }
 
 DoubleMatrix& DoubleMatrix::operator = (const DoubleMatrix& d) {
-  int i;
-  if (v != 0) {
+  if (this == &d)
+    return *this;
+
+  int i, j, same;
+  //copy in place if the matrices have the same shape, to avoid reallocating memory
+  same = (nrow == d.nrow);
+  for (i = 0; (same && i < nrow); i++)
+    same = (v[i]->Size() == d[i].Size());
+  if (same) {
     for (i = 0; i < nrow; i++)
-      delete v[i];
-    delete[] v;
+      for (j = 0; j < d[i].Size(); j++)
+        (*v[i])[j] = d[i][j];
+    return *this;
   }
 
-  nrow = d.nrow;
-  if (nrow > 0) {
-    v = new DoubleVector*[nrow];
+  this->freeStore();
+  if (d.nrow > 0) {
+    IntVector size(d.nrow, 0);
+    for (i = 0; i < d.nrow; i++)
+      size[i] = d[i].Size();
+    this->allocate(size);
     for (i = 0; i < nrow; i++)
-      v[i] = new DoubleVector(d[i]);
-
-  } else
-    v = 0;
-
+      for (j = 0; j < size[i]; j++)
+        (*v[i])[j] = d[i][j];
+  }
   return *this;
 }
 
 void DoubleMatrix::Reset() {
-  if (nrow > 0) {
-    int i;
-    for (i = 0; i < nrow; i++)
-      delete v[i];
-    delete[] v;
-    v = 0;
-    nrow = 0;
-  }
+  this->freeStore();
 }
 
 void DoubleMatrix::Print(ofstream& outfile) const {
@@ -2,6 +2,7 @@
 #include "gadget.h"
 
 DoubleVector::DoubleVector(int sz) {
+  owner = 1;
   size = (sz > 0 ? sz : 0);
   if (size > 0)
     v = new double[size];
@@ -10,6 +11,7 @@ DoubleVector::DoubleVector(int sz) {
 }
 
 DoubleVector::DoubleVector(int sz, double value) {
+  owner = 1;
   size = (sz > 0 ? sz : 0);
   int i;
   if (size > 0) {
@@ -21,6 +23,7 @@ DoubleVector::DoubleVector(int sz, double value) {
 }
 
 DoubleVector::DoubleVector(const DoubleVector& initial) {
+  owner = 1;
   size = initial.size;
   int i;
   if (size > 0) {
@@ -31,13 +34,27 @@ DoubleVector::DoubleVector(const DoubleVector& initial) {
     v = 0;
 }
 
+DoubleVector::DoubleVector(int sz, double* store) {
+  owner = 0;
+  size = (sz > 0 ? sz : 0);
+  v = (size > 0 ? store : 0);
+}
+
 DoubleVector::~DoubleVector() {
-  if (v != 0) {
+  if ((v != 0) && (owner)) {
     delete[] v;
     v = 0;
   }
 }
 
+void DoubleVector::setStore(int sz, double* store) {
+  if ((v != 0) && (owner))
+    delete[] v;
+  owner = 0;
+  size = (sz > 0 ? sz : 0);
+  v = (size > 0 ? store : 0);
+}
+
 void DoubleVector::resize(int addsize, double value) {
   if (addsize <= 0)
     return;
@@ -46,6 +63,7 @@ void DoubleVector::resize(int addsize, double value) {
   if (v == 0) {
     size = addsize;
     v = new double[size];
+    owner = 1;
     for (i = 0; i < size; i++)
       v[i] = value;
 
@@ -55,8 +73,10 @@ void DoubleVector::resize(int addsize, double value) {
       vnew[i] = v[i];
     for (i = size; i < size + addsize; i++)
       vnew[i] = value;
-    delete[] v;
+    if (owner)
+      delete[] v;
     v = vnew;
+    owner = 1;
     size += addsize;
   }
 }
@@ -69,20 +89,26 @@ void DoubleVector::Delete(int pos) {
       vnew[i] = v[i];
     for (i = pos; i < size - 1; i++)
       vnew[i] = v[i + 1];
-    delete[] v;
+    if (owner)
+      delete[] v;
     v = vnew;
+    owner = 1;
     size--;
   } else {
-    delete[] v;
+    if (owner)
+      delete[] v;
     v = 0;
+    owner = 1;
     size = 0;
   }
 }
 
 void DoubleVector::Reset() {
   if (size > 0) {
-    delete[] v;
+    if (owner)
+      delete[] v;
     v = 0;
+    owner = 1;
     size = 0;
   }
 }
@@ -109,10 +135,10 @@ DoubleVector& DoubleVector::operator = (const DoubleVector& d) {
       v[i] = d[i];
     return *this;
   }
-  if (v != 0) {
+  if ((v != 0) && (owner))
     delete[] v;
-    v = 0;
-  }
+  v = 0;
+  owner = 1;
   size = d.size;
   if (size > 0) {
     v = new double[size];
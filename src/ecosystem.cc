@@ -1,13 +1,58 @@
 #include "ecosystem.h"
 #include "runid.h"
+#include "mathfunc.h"
 #include "global.h"
 
-Ecosystem::Ecosystem(const MainInfo& main) : printinfo(main.getPI()) {
+Ecosystem::Ecosystem(const MainInfo& main, int worker) : printinfo(main.getPI()) {
+
+  // the worker copies of the model have their own ErrorHandler, which only displays the failure messages
+  ErrorHandler* lasthandler = ErrorHandler::getActive();
+  errorhandler = &handle;
+  if (worker) {
+    errorhandler = new ErrorHandler;
+    errorhandler->setLogLevel(LOGFAIL);
+    errorhandler->setRunOptimise(handle.getRunOptimise());
+    ErrorHandler::setActive(errorhandler);
+  }
 
   funceval = 0;
   interrupted = 0;
   likelihood = 0.0;
+  isworker = worker;
+  numforks = 0;
+  batchpoints = 0;
+  batchlikes = 0;
+  batchvalues = 0;
+  batchscores = 0;
+  batchstart = 0;
+  batchstep = 1;
+  numcheckpoints = 0;
+  checkcapture = 0;
+  checkresumed = 0;
+  checkreply = -1;
+  checkid = 0;
+  profbase = 0;
+  proflike = 0;
+  likeconcurrent = 0;
+  areaconcurrent = 0;
+  stockarea = 0;
+  usecutoff = 0;
+  simcutoff = 0.0;
+  simstopped = 0;
+  cachehit = 0;
+  profile.setActive(main.getProfileGiven());
+
+  //only use the faster approximations to the math functions if they are accurate enough
+  if ((main.getFastMath()) && (!isworker)) {
+    double matherror = checkMathAccuracy();
+    if (matherror < mathaccuracy) {
+      setMathMode(MATHFAST);
+      handle.logMessage(LOGMESSAGE, "Using faster approximations to the math functions, largest error found", matherror);
+    } else
+      handle.logMessage(LOGWARN, "Warning - faster approximations to the math functions are not accurate enough, largest error found", matherror);
+  }
   keeper = new Keeper;
+  keeper->setModelStocks(&stockvec);
 
   // initialise counter used when printing output files
   printcount = printinfo.getPrintIteration() - 1;
@@ -24,6 +69,12 @@ Ecosystem::Ecosystem(const MainInfo& main) : printinfo(main.getPI()) {
   infile.close();
   infile.clear();
 
+  // the worker copies of the model dont need the optimisation parameters
+  if (isworker) {
+    ErrorHandler::setActive(lasthandler);
+    return;
+  }
+
   // if this is an optimising run then read the optimisation parameters from file
   if (main.runOptimise()) {
     handle.logMessage(LOGMESSAGE, "");  //write blank line to log file
@@ -38,10 +89,56 @@ Ecosystem::Ecosystem(const MainInfo& main) : printinfo(main.getPI()) {
       infile.clear();
     } else {
       handle.logMessage(LOGINFO, "Warning - no optimisation file specified, using default values");
-      optvec.resize(new OptInfoHooke());
+      optvec.resize(new OptInfoHooke(this));
     }
+
+    // the snapshots of the model are only used when optimising
+    numcheckpoints = main.getNumCheckpoints();
+    if (numcheckpoints > 0)
+      handle.logMessage(LOGMESSAGE, "Using snapshots to resume the model simulation, number of snapshots", numcheckpoints);
+
+    // the likelihood scores are only stored when optimising
+    evalcache.setSize(main.getEvalCacheSize());
+    if (evalcache.isActive())
+      handle.logMessage(LOGMESSAGE, "Storing the likelihood scores in an evaluation cache, number of points", main.getEvalCacheSize());
   }
 
+  // the worker processes are started once the model has been initialised
+  numforks = main.getNumForks();
+  if (numforks > 0)
+    handle.logMessage(LOGMESSAGE, "Using worker processes to run the model, number of processes", numforks);
+
+  // the optimisation algorithms that havent been given the number of threads use the number from the command line
+  int i;
+  for (i = 0; i < optvec.Size(); i++)
+    optvec[i]->setDefaultThreads(main.getNumThreads());
+
+#ifdef GADGET_THREADS
+  // create the worker copies of the model needed by the optimisation algorithms
+  int numthreads = main.getNumThreads();
+  for (i = 0; i < optvec.Size(); i++)
+    if (optvec[i]->getNumThreads() > numthreads)
+      numthreads = optvec[i]->getNumThreads();
+
+  if ((numthreads > 1) && (numforks == 0)) {
+    handle.logMessage(LOGMESSAGE, "Creating worker copies of the model, number of threads", numthreads);
+    for (i = 1; i < numthreads; i++)
+      workers.resize(new Ecosystem(main, 1));
+  }
+
+  // start the threads used within each simulation of the model
+  if ((main.getNumSimThreads() > 1) && (!isworker)) {
+    handle.logMessage(LOGMESSAGE, "Using threads within each simulation of the model, number of threads", main.getNumSimThreads());
+    simpool.startThreads(main.getNumSimThreads());
+  }
+
+  // the snapshots are taken using fork(), which can leave a lock that is held by another thread locked for ever
+  if ((numcheckpoints > 0) && ((workers.Size() > 0) || (main.getNumSimThreads() > 1))) {
+    handle.logMessage(LOGWARN, "Warning - Gadget cannot keep snapshots of the model when using more than one thread");
+    numcheckpoints = 0;
+  }
+#endif
+
   if (main.runOptimise())
     handle.logMessage(LOGINFO, "\nFinished reading model data files, starting to run optimisation");
   else
@@ -51,6 +148,11 @@ Ecosystem::Ecosystem(const MainInfo& main) : printinfo(main.getPI()) {
 
 Ecosystem::~Ecosystem() {
   int i;
+  if (farmfd.Size() > 0)
+    this->stopFarm();
+  if (checkfd.Size() > 0)
+    this->stopCheckpoints();
+
   for (i = 0; i < optvec.Size(); i++)
     delete optvec[i];
   for (i = 0; i < printvec.Size(); i++)
@@ -62,9 +164,14 @@ Ecosystem::~Ecosystem() {
   for (i = 0; i < basevec.Size(); i++)
     delete basevec[i];
 
+  for (i = 0; i < workers.Size(); i++)
+    delete workers[i];
+
   delete Area;
   delete TimeInfo;
   delete keeper;
+  if (errorhandler != &handle)
+    delete errorhandler;
 }
 
 void Ecosystem::writeStatus(const char* filename) const {
@@ -102,14 +209,25 @@ void Ecosystem::Optimise() {
   int i;
   for (i = 0; i < optvec.Size(); i++) {
     optvec[i]->OptimiseLikelihood();
+    if ((checkresumed) || (cachehit) || (simstopped)) {
+      //the model needs to be run again to get the model state for the last point
+      keeper->Update(currentval);
+      this->Simulate(0);
+      checkresumed = 0;
+      cachehit = 0;
+      simstopped = 0;
+    }
     this->writeOptValues();
+    evalcache.logStatistics();
   }
+  if (checkfd.Size() > 0)
+    this->stopCheckpoints();
 }
 
-double Ecosystem::SimulateAndUpdate(const DoubleVector& x) {
+void Ecosystem::convertScaledValues(const DoubleVector& x, DoubleVector& val) {
   int i, j;
 
-  if (funceval == 0) {
+  if (optflag.Size() == 0) {
     // JMB - only need to create these vectors once
     initialval.resize(keeper->numVariables(), 0.0);
     currentval.resize(keeper->numVariables(), 0.0);
@@ -118,22 +236,58 @@ double Ecosystem::SimulateAndUpdate(const DoubleVector& x) {
   }
 
   j = 0;
-  keeper->getCurrentValues(currentval);
+  keeper->getCurrentValues(val);
   keeper->getInitialValues(initialval);
-  for (i = 0; i < currentval.Size(); i++) {
+  for (i = 0; i < val.Size(); i++) {
     if (optflag[i]) {
-      currentval[i] = x[j] * initialval[i];
+      val[i] = x[j] * initialval[i];
       j++;
     }
   }
+}
+
+double Ecosystem::SimulateAndUpdate(const DoubleVector& x) {
+  int entry;
+  this->convertScaledValues(x, currentval);
+  checkresumed = 0;
+  cachehit = 0;
+  entry = evalcache.Find(currentval);
+  if (entry >= 0) {
+    //the likelihood score for these values has already been calculated
+    cachehit = 1;
+    simstopped = 0;
+    likelihood = evalcache.getScore(entry);
+    keeper->Update(evalcache.getValues(entry));
+
+  } else {
+    if (checkfd.Size() > 0)
+      checkresumed = this->resumeSimulation(currentval);
 
-  keeper->Update(currentval);
-  this->Simulate(0);  //dont print whilst optimising
+    if (!checkresumed) {
+      keeper->Update(currentval);
+      checkcapture = (numcheckpoints > 0);
+      this->Simulate(0);  //dont print whilst optimising
+      checkcapture = 0;
+      if (numcheckpoints > 0)
+        this->updateCheckpoints(currentval);
+    }
+
+    //the likelihood score from a model run that was stopped early isnt stored
+    if (checkresumed)
+      evalcache.Store(currentval, checkval, likelihood, checklikes);
+    else if (!simstopped)
+      evalcache.Store(currentval, keeper, likelihood, likevec);
+  }
 
   if (printinfo.getPrint()) {
     printcount++;
     if (printcount == printinfo.getPrintIteration()) {
-      keeper->writeValues(likevec, printinfo.getPrecision());
+      if (cachehit)
+        keeper->writeValues(evalcache.getValues(entry), evalcache.getLikelihoods(entry), funceval, likelihood, printinfo.getPrecision());
+      else if (checkresumed)
+        keeper->writeValues(checkval, checklikes, funceval, likelihood, printinfo.getPrecision());
+      else
+        keeper->writeValues(likevec, funceval, likelihood, printinfo.getPrecision());
       printcount = 0;
     }
   }
@@ -142,6 +296,34 @@ double Ecosystem::SimulateAndUpdate(const DoubleVector& x) {
   return likelihood;
 }
 
+double Ecosystem::SimulateAndUpdate(const DoubleVector& x, double cutoff) {
+  int i;
+  double score;
+
+  //the likelihood score so far is only a lower bound if none of the components can decrease
+  usecutoff = ((numcheckpoints == 0) && (checkfd.Size() == 0) && (!printinfo.getPrint()));
+  for (i = 0; i < likevec.Size(); i++)
+    if ((likevec[i]->getWeight() < 0.0) || ((likevec[i]->getWeight() > 0.0) && (!likevec[i]->isIncreasing())))
+      usecutoff = 0;
+
+  simcutoff = cutoff;
+  score = this->SimulateAndUpdate(x);
+  usecutoff = 0;
+  return score;
+}
+
+double Ecosystem::finishSimulation() {
+  if (simstopped) {
+    //the bounds can have changed the values stored in keeper, so they are set again
+    keeper->Update(currentval);
+    this->Simulate(0);
+    if (simstopped)
+      handle.logMessage(LOGFAIL, "Error in ecosystem - failed to complete the model run");
+    evalcache.Store(currentval, keeper, likelihood, likevec);
+  }
+  return likelihood;
+}
+
 void Ecosystem::writeOptValues() {
   int i;
   DoubleVector tmpvec(likevec.Size(), 0.0);
@@ -158,13 +340,25 @@ void Ecosystem::writeOptValues() {
     handle.logMessage(LOGINFO, "\nThe overall likelihood score is", this->getLikelihood());
 }
 
+void Ecosystem::writeProfile(const char* const filename) {
+  int i;
+  if (!profile.isActive())
+    return;
+
+  //include the time spent by the worker copies of the model
+  for (i = 0; i < workers.Size(); i++)
+    profile.addProfile(workers[i]->profile);
+  profile.Print();
+  profile.writeFile(filename);
+}
+
 void Ecosystem::writeInitialInformation(const char* const filename) {
   keeper->openPrintFile(filename);
   keeper->writeInitialInformation(likevec);
 }
 
 void Ecosystem::writeValues() {
-  keeper->writeValues(likevec, printinfo.getPrecision());
+  keeper->writeValues(likevec, funceval, likelihood, printinfo.getPrecision());
 }
 
 void Ecosystem::writeParams(const char* const filename, int prec) const {
@@ -172,7 +366,7 @@ void Ecosystem::writeParams(const char* const filename, int prec) const {
     //JMB - print the final values to any output files specified
     //in case they have been missed by the -print value
     if (printinfo.getPrint())
-      keeper->writeValues(likevec, printinfo.getPrecision());
+      keeper->writeValues(likevec, funceval, likelihood, printinfo.getPrecision());
   }
-  keeper->writeParams(optvec, filename, prec, interrupted);
+  keeper->writeParams(optvec, filename, funceval, likelihood, prec, interrupted);
 }
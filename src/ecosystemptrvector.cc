@@ -0,0 +1,53 @@
+#include "ecosystemptrvector.h"
+#include "gadget.h"
+
+EcosystemPtrVector::EcosystemPtrVector(const EcosystemPtrVector& initial) {
+  size = initial.size;
+  int i;
+  if (size > 0) {
+    v = new Ecosystem*[size];
+    for (i = 0; i < size; i++)
+      v[i] = initial.v[i];
+  } else
+    v = 0;
+}
+
+EcosystemPtrVector::~EcosystemPtrVector() {
+  if (v != 0) {
+    delete[] v;
+    v = 0;
+  }
+}
+
+void EcosystemPtrVector::resize(Ecosystem* value) {
+  int i;
+  if (v == 0) {
+    v = new Ecosystem*[1];
+  } else {
+    Ecosystem** vnew = new Ecosystem*[size + 1];
+    for (i = 0; i < size; i++)
+      vnew[i] = v[i];
+    delete[] v;
+    v = vnew;
+  }
+  v[size] = value;
+  size++;
+}
+
+void EcosystemPtrVector::Delete(int pos) {
+  int i;
+  if (size > 1) {
+    Ecosystem** vnew = new Ecosystem*[size - 1];
+    for (i = 0; i < pos; i++)
+      vnew[i] = v[i];
+    for (i = pos; i < size - 1; i++)
+      vnew[i] = v[i + 1];
+    delete[] v;
+    v = vnew;
+    size--;
+  } else {
+    delete[] v;
+    v = 0;
+    size = 0;
+  }
+}
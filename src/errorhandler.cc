@@ -6,20 +6,70 @@
 #include "runid.h"
 #endif
 
+//each thread can pass the messages to the ErrorHandler for the model that it is running
+#ifdef GADGET_THREADS
+static __thread ErrorHandler* activehandler = 0;
+#else
+static ErrorHandler* activehandler = 0;
+#endif
+
+void ErrorHandler::setActive(ErrorHandler* eh) {
+  activehandler = eh;
+}
+
+ErrorHandler* ErrorHandler::getActive() {
+  return activehandler;
+}
+
+ErrorHandler* ErrorHandler::getHandler() {
+  if (activehandler != 0)
+    return activehandler;
+  return this;
+}
+
+const ErrorHandler* ErrorHandler::getHandler() const {
+  if (activehandler != 0)
+    return activehandler;
+  return this;
+}
+
 ErrorHandler::ErrorHandler() {
   files = new StrStack();
   uselog = 0;
   numwarn = 0;
   runopt = 0;
-  nanflag = 0;
   loglevel = LOGINFO;
+#ifdef GADGET_THREADS
+  pthread_mutex_init(&logmutex, NULL);
+#endif
 }
 
 ErrorHandler::~ErrorHandler() {
   delete files;
+#ifdef GADGET_THREADS
+  pthread_mutex_destroy(&logmutex);
+#endif
+}
+
+void ErrorHandler::lockLog() {
+#ifdef GADGET_THREADS
+  pthread_mutex_lock(&logmutex);
+#endif
+}
+
+void ErrorHandler::unlockLog() {
+#ifdef GADGET_THREADS
+  pthread_mutex_unlock(&logmutex);
+#endif
 }
 
 void ErrorHandler::setLogLevel(int level) {
+  ErrorHandler* eh = this->getHandler();
+  if (eh != this) {
+    eh->setLogLevel(level);
+    return;
+  }
+
   switch (level) {
     case 0:
       //no messages displayed at all - only used for paramin runs
@@ -57,6 +107,12 @@ void ErrorHandler::setLogLevel(int level) {
 }
 
 void ErrorHandler::setLogFile(const char* filename) {
+  ErrorHandler* eh = this->getHandler();
+  if (eh != this) {
+    eh->setLogFile(filename);
+    return;
+  }
+
   uselog = 1;
   logfile.open(filename, ios::out);
   this->checkIfFailure(logfile, filename);
@@ -68,11 +124,23 @@ void ErrorHandler::setLogFile(const char* filename) {
 }
 
 void ErrorHandler::Open(const char* filename) {
+  ErrorHandler* eh = this->getHandler();
+  if (eh != this) {
+    eh->Open(filename);
+    return;
+  }
+
   this->logMessage(LOGMESSAGE, "Opening file", filename);
   files->storeString(filename);
 }
 
 void ErrorHandler::Close() {
+  ErrorHandler* eh = this->getHandler();
+  if (eh != this) {
+    eh->Close();
+    return;
+  }
+
   if (loglevel >= LOGMESSAGE) {
     char* strFilename = files->sendTop();
     this->logMessage(LOGMESSAGE, "Closing file", strFilename);
@@ -82,9 +150,16 @@ void ErrorHandler::Close() {
 }
 
 void ErrorHandler::logMessage(LogLevel mlevel, const char* msg) {
+  ErrorHandler* eh = this->getHandler();
+  if (eh != this) {
+    eh->logMessage(mlevel, msg);
+    return;
+  }
+
   if (mlevel > loglevel)
     return;
 
+  this->lockLog();
   switch (mlevel) {
     case LOGNONE:
       break;
@@ -123,12 +198,20 @@ void ErrorHandler::logMessage(LogLevel mlevel, const char* msg) {
       cerr << "Error in errorhandler - invalid log level " << mlevel << endl;
       break;
   }
+  this->unlockLog();
 }
 
 void ErrorHandler::logMessage(LogLevel mlevel, const char* msg1, const char* msg2) {
+  ErrorHandler* eh = this->getHandler();
+  if (eh != this) {
+    eh->logMessage(mlevel, msg1, msg2);
+    return;
+  }
+
   if (mlevel > loglevel)
     return;
 
+  this->lockLog();
   switch (mlevel) {
     case LOGNONE:
       break;
@@ -167,12 +250,20 @@ void ErrorHandler::logMessage(LogLevel mlevel, const char* msg1, const char* msg
       cerr << "Error in errorhandler - invalid log level " << mlevel << endl;
       break;
   }
+  this->unlockLog();
 }
 
 void ErrorHandler::logMessage(LogLevel mlevel, const char* msg, int number) {
+  ErrorHandler* eh = this->getHandler();
+  if (eh != this) {
+    eh->logMessage(mlevel, msg, number);
+    return;
+  }
+
   if (mlevel > loglevel)
     return;
 
+  this->lockLog();
   switch (mlevel) {
     case LOGNONE:
       break;
@@ -211,12 +302,20 @@ void ErrorHandler::logMessage(LogLevel mlevel, const char* msg, int number) {
       cerr << "Error in errorhandler - invalid log level " << mlevel << endl;
       break;
   }
+  this->unlockLog();
 }
 
 void ErrorHandler::logMessage(LogLevel mlevel, const char* msg, double number) {
+  ErrorHandler* eh = this->getHandler();
+  if (eh != this) {
+    eh->logMessage(mlevel, msg, number);
+    return;
+  }
+
   if (mlevel > loglevel)
     return;
 
+  this->lockLog();
   switch (mlevel) {
     case LOGNONE:
       break;
@@ -255,12 +354,20 @@ void ErrorHandler::logMessage(LogLevel mlevel, const char* msg, double number) {
       cerr << "Error in errorhandler - invalid log level " << mlevel << endl;
       break;
   }
+  this->unlockLog();
 }
 
 void ErrorHandler::logMessage(LogLevel mlevel, const char* msg1, int number, const char* msg2) {
+  ErrorHandler* eh = this->getHandler();
+  if (eh != this) {
+    eh->logMessage(mlevel, msg1, number, msg2);
+    return;
+  }
+
   if (mlevel > loglevel)
     return;
 
+  this->lockLog();
   switch (mlevel) {
     case LOGNONE:
       break;
@@ -299,12 +406,20 @@ void ErrorHandler::logMessage(LogLevel mlevel, const char* msg1, int number, con
       cerr << "Error in errorhandler - invalid log level " << mlevel << endl;
       break;
   }
+  this->unlockLog();
 }
 
 void ErrorHandler::logMessage(LogLevel mlevel, const char* msg1, double number, const char* msg2) {
+  ErrorHandler* eh = this->getHandler();
+  if (eh != this) {
+    eh->logMessage(mlevel, msg1, number, msg2);
+    return;
+  }
+
   if (mlevel > loglevel)
     return;
 
+  this->lockLog();
   switch (mlevel) {
     case LOGNONE:
       break;
@@ -343,13 +458,21 @@ void ErrorHandler::logMessage(LogLevel mlevel, const char* msg1, double number,
       cerr << "Error in errorhandler - invalid log level " << mlevel << endl;
       break;
   }
+  this->unlockLog();
 }
 
 void ErrorHandler::logMessage(LogLevel mlevel, DoubleVector vec) {
+  ErrorHandler* eh = this->getHandler();
+  if (eh != this) {
+    eh->logMessage(mlevel, vec);
+    return;
+  }
+
   if (mlevel > loglevel)
     return;
 
   int i;
+  this->lockLog();
   switch (mlevel) {
     case LOGNONE:
       break;
@@ -402,14 +525,21 @@ void ErrorHandler::logMessage(LogLevel mlevel, DoubleVector vec) {
       cerr << "Error in errorhandler - invalid log level " << mlevel << endl;
       break;
   }
+  this->unlockLog();
 }
 
 void ErrorHandler::logMessageNaN(LogLevel mlevel, const char* msg) {
+  ErrorHandler* eh = this->getHandler();
+  if (eh != this) {
+    eh->logMessageNaN(mlevel, msg);
+    return;
+  }
+
 
-  nanflag = 1;
   if (mlevel > loglevel)
     return;
 
+  this->lockLog();
   switch (mlevel) {
     case LOGNONE:
       break;
@@ -448,9 +578,16 @@ void ErrorHandler::logMessageNaN(LogLevel mlevel, const char* msg) {
       cerr << "Error in errorhandler - invalid log level " << mlevel << endl;
       break;
   }
+  this->unlockLog();
 }
 
 void ErrorHandler::logFileMessage(LogLevel mlevel, const char* msg) {
+  ErrorHandler* eh = this->getHandler();
+  if (eh != this) {
+    eh->logFileMessage(mlevel, msg);
+    return;
+  }
+
   if (mlevel > loglevel)
     return;
 
@@ -505,6 +642,12 @@ void ErrorHandler::logFileMessage(LogLevel mlevel, const char* msg) {
 
 
 void ErrorHandler::logFileMessage(LogLevel mlevel, const char* msg, int number) {
+  ErrorHandler* eh = this->getHandler();
+  if (eh != this) {
+    eh->logFileMessage(mlevel, msg, number);
+    return;
+  }
+
   if (mlevel > loglevel)
     return;
 
@@ -558,6 +701,12 @@ void ErrorHandler::logFileMessage(LogLevel mlevel, const char* msg, int number)
 }
 
 void ErrorHandler::logFileMessage(LogLevel mlevel, const char* msg, double number) {
+  ErrorHandler* eh = this->getHandler();
+  if (eh != this) {
+    eh->logFileMessage(mlevel, msg, number);
+    return;
+  }
+
   if (mlevel > loglevel)
     return;
 
@@ -611,6 +760,12 @@ void ErrorHandler::logFileMessage(LogLevel mlevel, const char* msg, double numbe
 }
 
 void ErrorHandler::logFileMessage(LogLevel mlevel, const char* msg1, const char* msg2) {
+  ErrorHandler* eh = this->getHandler();
+  if (eh != this) {
+    eh->logFileMessage(mlevel, msg1, msg2);
+    return;
+  }
+
   if (mlevel > loglevel)
     return;
 
@@ -664,6 +819,12 @@ void ErrorHandler::logFileMessage(LogLevel mlevel, const char* msg1, const char*
 }
 
 void ErrorHandler::logFileEOFMessage(LogLevel mlevel) {
+  ErrorHandler* eh = this->getHandler();
+  if (eh != this) {
+    eh->logFileEOFMessage(mlevel);
+    return;
+  }
+
   if (mlevel > loglevel)
     return;
 
@@ -705,6 +866,12 @@ void ErrorHandler::logFileEOFMessage(LogLevel mlevel) {
 }
 
 void ErrorHandler::logFileUnexpected(LogLevel mlevel, const char* msg1, const char* msg2) {
+  ErrorHandler* eh = this->getHandler();
+  if (eh != this) {
+    eh->logFileUnexpected(mlevel, msg1, msg2);
+    return;
+  }
+
   if (mlevel > loglevel)
     return;
 
@@ -751,6 +918,12 @@ void ErrorHandler::logFileUnexpected(LogLevel mlevel, const char* msg1, const ch
 }
 
 void ErrorHandler::checkIfFailure(ios& infile, const char* text) {
+  ErrorHandler* eh = this->getHandler();
+  if (eh != this) {
+    eh->checkIfFailure(infile, text);
+    return;
+  }
+
   if (infile.fail()) {
     if ((uselog) && (loglevel >= LOGMESSAGE)) {
       logfile << "Checking to see if file " << text << " can be opened ... failed" << endl;
@@ -766,6 +939,12 @@ void ErrorHandler::checkIfFailure(ios& infile, const char* text) {
 }
 
 void ErrorHandler::logFinish() {
+  ErrorHandler* eh = this->getHandler();
+  if (eh != this) {
+    eh->logFinish();
+    return;
+  }
+
   if (numwarn > 0)
     this->logMessage(LOGINFO, "\nTotal number of warnings was", numwarn);
 
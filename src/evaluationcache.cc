@@ -0,0 +1,111 @@
+#include "evaluationcache.h"
+#include "errorhandler.h"
+#include "gadget.h"
+#include "global.h"
+
+int EvaluationCache::Find(const DoubleVector& point) {
+  int i, j, hash, found;
+  if (maxsize == 0)
+    return -1;
+
+  hash = this->hashPoint(point);
+  for (i = 0; i < points.Nrow(); i++) {
+    if ((hashes[i] != hash) || (points[i].Size() != point.Size()))
+      continue;
+
+    found = 1;
+    for (j = 0; j < point.Size(); j++) {
+      if (points[i][j] != point[j]) {
+        found = 0;
+        break;
+      }
+    }
+    if (found) {
+      counter++;
+      lastused[i] = counter;
+      numhits++;
+      return i;
+    }
+  }
+
+  nummisses++;
+  return -1;
+}
+
+void EvaluationCache::Store(const DoubleVector& point, const DoubleVector& val,
+  double score, const DoubleVector& likevalues) {
+
+  int entry;
+  if (maxsize == 0)
+    return;
+
+  entry = this->newEntry(point, likevalues.Size());
+  points[entry] = point;
+  values[entry] = val;
+  likes[entry] = likevalues;
+  scores[entry] = score;
+}
+
+void EvaluationCache::Store(const DoubleVector& point, const Keeper* const keeper,
+  double score, const LikelihoodPtrVector& likevec) {
+
+  int i, entry;
+  if (maxsize == 0)
+    return;
+
+  entry = this->newEntry(point, likevec.Size());
+  points[entry] = point;
+  keeper->getCurrentValues(values[entry]);
+  for (i = 0; i < likevec.Size(); i++)
+    likes[entry][i] = likevec[i]->getUnweightedLikelihood();
+  scores[entry] = score;
+}
+
+int EvaluationCache::newEntry(const DoubleVector& point, int numlikes) {
+  int i, entry;
+  counter++;
+  if (points.Nrow() < maxsize) {
+    //the rows are only created as they are needed, up to the maximum number of points
+    points.AddRows(1, point.Size(), 0.0);
+    values.AddRows(1, point.Size(), 0.0);
+    likes.AddRows(1, numlikes, 0.0);
+    scores.resize(1, 0.0);
+    hashes.resize(1, 0);
+    lastused.resize(1, 0);
+    entry = points.Nrow() - 1;
+
+  } else {
+    //replace the point that was used least recently
+    entry = 0;
+    for (i = 1; i < points.Nrow(); i++)
+      if (lastused[i] < lastused[entry])
+        entry = i;
+  }
+
+  hashes[entry] = this->hashPoint(point);
+  lastused[entry] = counter;
+  return entry;
+}
+
+int EvaluationCache::hashPoint(const DoubleVector& point) const {
+  int i, j;
+  unsigned int hash;
+  unsigned char bytes[sizeof(double)];
+
+  //the hash is calculated from the bytes of each value, so equal points have the same hash
+  hash = 2166136261U;
+  for (i = 0; i < point.Size(); i++) {
+    memcpy(bytes, &point[i], sizeof(double));
+    for (j = 0; j < (int)sizeof(double); j++)
+      hash = (hash ^ bytes[j]) * 16777619U;
+  }
+  return (int)(hash & 0x7FFFFFFF);
+}
+
+void EvaluationCache::logStatistics() const {
+  if (maxsize == 0)
+    return;
+
+  handle.logMessage(LOGMESSAGE, "\nThe likelihood score was found in the evaluation cache for", numhits, "points");
+  handle.logMessage(LOGMESSAGE, "The model was run for", nummisses, "points that were not found in the evaluation cache");
+}
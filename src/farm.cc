@@ -0,0 +1,227 @@
+#include "ecosystem.h"
+#include "farmfunc.h"
+#include "errorhandler.h"
+#include "gadget.h"
+#include "global.h"
+
+#ifdef NOT_WINDOWS
+
+void Ecosystem::serveRequests(int fd) {
+  int i, tag, id;
+  int nvar = keeper->numVariables();
+  int nlike = likevec.Size();
+  DoubleVector val(nvar, 0.0);
+  DoubleVector likes(nlike, 0.0);
+  ParameterVector sw(nvar);
+
+  //send the description of the model to the other end of the connection
+  keeper->getSwitches(sw);
+  if (!farmWriteInt(fd, FARMVERSION) || !farmWriteInt(fd, nvar) || !farmWriteInt(fd, nlike))
+    return;
+  for (i = 0; i < nvar; i++)
+    if (!farmWriteString(fd, sw[i].getName()))
+      return;
+  for (i = 0; i < nlike; i++)
+    if (!farmWriteString(fd, likevec[i]->getName()))
+      return;
+  keeper->getLowerBounds(val);
+  if (!farmWriteVector(fd, val))
+    return;
+  keeper->getUpperBounds(val);
+  if (!farmWriteVector(fd, val))
+    return;
+  keeper->getCurrentValues(val);
+  if (!farmWriteVector(fd, val))
+    return;
+
+  //then run the model for each request until the connection is closed
+  while (farmReadInt(fd, tag) && (tag == FARMSIMULATE)) {
+    if (!farmReadInt(fd, id) || !farmReadVector(fd, val))
+      return;
+
+    keeper->Update(val);
+    this->Simulate(0);  //dont print whilst running as a worker
+    for (i = 0; i < nlike; i++)
+      likes[i] = likevec[i]->getUnweightedLikelihood();
+
+    //the values can have been changed by the bound likelihood, so they are sent back
+    keeper->getCurrentValues(val);
+    if (!farmWriteInt(fd, id) || !farmWriteDouble(fd, likelihood) || !farmWriteVector(fd, likes) || !farmWriteVector(fd, val))
+      return;
+    funceval++;
+  }
+}
+
+void Ecosystem::startFarm() {
+  int i, j, len, check, pid;
+  int fds[2];
+  int nvar = keeper->numVariables();
+  int nlike = likevec.Size();
+  DoubleVector tmpvec(nvar, 0.0);
+  char text[MaxStrLength];
+  strncpy(text, "", MaxStrLength);
+
+  //a worker process that has died should be reported as an error, not kill Gadget
+  signal(SIGPIPE, SIG_IGN);
+  handle.logMessage(LOGMESSAGE, "Starting worker processes, number of processes", numforks);
+  for (i = 0; i < numforks; i++) {
+    if (socketpair(AF_UNIX, SOCK_STREAM, 0, fds) != 0)
+      handle.logMessage(LOGFAIL, "Error in ecosystem - failed to create socket for worker process", i);
+
+    pid = fork();
+    if (pid < 0)
+      handle.logMessage(LOGFAIL, "Error in ecosystem - failed to create worker process", i);
+
+    if (pid == 0) {
+      //this is the worker process, which only needs its own connection
+      close(fds[0]);
+      for (j = 0; j < farmfd.Size(); j++)
+        close(farmfd[j]);
+      isworker = 1;
+      this->serveRequests(fds[1]);
+      close(fds[1]);
+      _exit(EXIT_SUCCESS);  //dont run the destructors, since they belong to the master
+    }
+
+    close(fds[1]);
+    farmfd.resize(1, fds[0]);
+    farmpid.resize(1, pid);
+  }
+
+  //check the description of the model that is sent by each worker process
+  for (i = 0; i < farmfd.Size(); i++) {
+    check = farmReadInt(farmfd[i], j) && (j == FARMVERSION);
+    check = check && farmReadInt(farmfd[i], j) && (j == nvar);
+    check = check && farmReadInt(farmfd[i], j) && (j == nlike);
+    for (j = 0; j < (nvar + nlike) && check; j++) {
+      check = farmReadInt(farmfd[i], len) && (len >= 0) && (len < MaxStrLength);
+      if (check)
+        check = farmReadString(farmfd[i], text, len);
+    }
+    for (j = 0; j < 3 && check; j++)
+      check = farmReadVector(farmfd[i], tmpvec);
+    if (!check)
+      handle.logMessage(LOGFAIL, "Error in ecosystem - failed to start worker process", i);
+  }
+}
+
+void Ecosystem::stopFarm() {
+  int i, status;
+  for (i = 0; i < farmfd.Size(); i++) {
+    farmWriteInt(farmfd[i], FARMSTOP);
+    close(farmfd[i]);
+  }
+  for (i = 0; i < farmpid.Size(); i++)
+    waitpid(farmpid[i], &status, 0);
+
+  farmfd.Reset();
+  farmpid.Reset();
+}
+
+void Ecosystem::simulateFarm(const DoubleMatrix& points, DoubleVector& f, DoubleMatrix& likes, DoubleMatrix& values) {
+  int i, id, numsent, numdone;
+  int numfarm = farmfd.Size();
+  IntVector busy(numfarm, 0);
+  struct pollfd* fds = new struct pollfd[numfarm];
+
+  //start by giving one point to each worker process
+  numsent = 0;
+  numdone = 0;
+  for (i = 0; i < numfarm && numsent < points.Nrow(); i++) {
+    if (!farmWriteInt(farmfd[i], FARMSIMULATE) || !farmWriteInt(farmfd[i], numsent) || !farmWriteVector(farmfd[i], points[numsent]))
+      handle.logMessage(LOGFAIL, "Error in ecosystem - failed to send point to worker process", i);
+    busy[i] = 1;
+    numsent++;
+  }
+
+  //then give the next point to each worker process as it finishes the previous one
+  while (numdone < points.Nrow()) {
+    for (i = 0; i < numfarm; i++) {
+      fds[i].fd = farmfd[i];
+      fds[i].events = (busy[i] ? POLLIN : 0);
+      fds[i].revents = 0;
+    }
+    if (poll(fds, numfarm, -1) < 0) {
+      if (errno == EINTR)
+        continue;
+      handle.logMessage(LOGFAIL, "Error in ecosystem - failed to wait for worker processes");
+    }
+
+    for (i = 0; i < numfarm; i++) {
+      if (!busy[i] || (fds[i].revents == 0))
+        continue;
+
+      if (!farmReadInt(farmfd[i], id) || (id < 0) || (id >= points.Nrow())
+          || !farmReadDouble(farmfd[i], f[id]) || !farmReadVector(farmfd[i], likes[id])
+          || !farmReadVector(farmfd[i], values[id]))
+        handle.logMessage(LOGFAIL, "Error in ecosystem - lost connection to worker process", i);
+
+      busy[i] = 0;
+      numdone++;
+      if (numsent < points.Nrow()) {
+        if (!farmWriteInt(farmfd[i], FARMSIMULATE) || !farmWriteInt(farmfd[i], numsent) || !farmWriteVector(farmfd[i], points[numsent]))
+          handle.logMessage(LOGFAIL, "Error in ecosystem - failed to send point to worker process", i);
+        busy[i] = 1;
+        numsent++;
+      }
+    }
+  }
+  delete[] fds;
+}
+
+void Ecosystem::serveSocket(const char* const filename) {
+  int listenfd, fd;
+  struct sockaddr_un addr;
+
+  if (strlen(filename) >= sizeof(addr.sun_path))
+    handle.logMessage(LOGFAIL, "Error in ecosystem - socket name is too long", filename);
+
+  signal(SIGPIPE, SIG_IGN);
+  memset(&addr, 0, sizeof(addr));
+  addr.sun_family = AF_UNIX;
+  strcpy(addr.sun_path, filename);
+  unlink(filename);  //remove any socket left over from a previous run
+
+  listenfd = socket(AF_UNIX, SOCK_STREAM, 0);
+  if (listenfd < 0)
+    handle.logMessage(LOGFAIL, "Error in ecosystem - failed to create socket", filename);
+  if ((bind(listenfd, (struct sockaddr*)&addr, sizeof(addr)) != 0) || (listen(listenfd, 1) != 0))
+    handle.logMessage(LOGFAIL, "Error in ecosystem - failed to listen on socket", filename);
+
+  handle.logMessage(LOGMESSAGE, "Waiting for a connection to socket", filename);
+  do {
+    fd = accept(listenfd, NULL, NULL);
+  } while ((fd < 0) && (errno == EINTR));
+  if (fd < 0)
+    handle.logMessage(LOGFAIL, "Error in ecosystem - failed to accept connection to socket", filename);
+
+  this->serveRequests(fd);
+  handle.logMessage(LOGMESSAGE, "Connection to socket closed after", funceval, "function evaluations");
+
+  close(fd);
+  close(listenfd);
+  unlink(filename);
+}
+
+#else
+
+void Ecosystem::serveRequests(int fd) {
+  handle.logMessage(LOGFAIL, "Error in ecosystem - worker processes are not supported on this platform");
+}
+
+void Ecosystem::startFarm() {
+  handle.logMessage(LOGFAIL, "Error in ecosystem - worker processes are not supported on this platform");
+}
+
+void Ecosystem::stopFarm() {
+}
+
+void Ecosystem::simulateFarm(const DoubleMatrix& points, DoubleVector& f, DoubleMatrix& likes, DoubleMatrix& values) {
+  handle.logMessage(LOGFAIL, "Error in ecosystem - worker processes are not supported on this platform");
+}
+
+void Ecosystem::serveSocket(const char* const filename) {
+  handle.logMessage(LOGFAIL, "Error in ecosystem - sockets are not supported on this platform");
+}
+
+#endif
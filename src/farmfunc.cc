@@ -0,0 +1,92 @@
+#include "farmfunc.h"
+#include "gadget.h"
+
+//write all of the data, restarting if the write is interrupted by a signal
+static int farmWrite(int fd, const void* buf, int size) {
+  const char* ptr = (const char*)buf;
+  int done;
+  while (size > 0) {
+    done = write(fd, ptr, size);
+    if ((done < 0) && (errno == EINTR))
+      continue;
+    if (done <= 0)
+      return 0;
+    ptr += done;
+    size -= done;
+  }
+  return 1;
+}
+
+//read all of the data, restarting if the read is interrupted by a signal
+static int farmRead(int fd, void* buf, int size) {
+  char* ptr = (char*)buf;
+  int done;
+  while (size > 0) {
+    done = read(fd, ptr, size);
+    if ((done < 0) && (errno == EINTR))
+      continue;
+    if (done <= 0)
+      return 0;
+    ptr += done;
+    size -= done;
+  }
+  return 1;
+}
+
+int farmWriteInt(int fd, int value) {
+  return farmWrite(fd, &value, sizeof(int));
+}
+
+int farmReadInt(int fd, int& value) {
+  return farmRead(fd, &value, sizeof(int));
+}
+
+int farmWriteDouble(int fd, double value) {
+  return farmWrite(fd, &value, sizeof(double));
+}
+
+int farmReadDouble(int fd, double& value) {
+  return farmRead(fd, &value, sizeof(double));
+}
+
+int farmWriteVector(int fd, const DoubleVector& vec) {
+  int i, check;
+  if (vec.Size() == 0)
+    return 1;
+
+  double* buf = new double[vec.Size()];
+  for (i = 0; i < vec.Size(); i++)
+    buf[i] = vec[i];
+  check = farmWrite(fd, buf, vec.Size() * sizeof(double));
+  delete[] buf;
+  return check;
+}
+
+int farmReadVector(int fd, DoubleVector& vec) {
+  int i, check;
+  if (vec.Size() == 0)
+    return 1;
+
+  double* buf = new double[vec.Size()];
+  check = farmRead(fd, buf, vec.Size() * sizeof(double));
+  if (check)
+    for (i = 0; i < vec.Size(); i++)
+      vec[i] = buf[i];
+  delete[] buf;
+  return check;
+}
+
+int farmWriteString(int fd, const char* text) {
+  int len = strlen(text);
+  if (!farmWriteInt(fd, len))
+    return 0;
+  return farmWrite(fd, text, len);
+}
+
+int farmReadString(int fd, char* text, int len) {
+  text[0] = '\0';
+  if (!farmRead(fd, text, len))
+    return 0;
+  text[len] = '\0';
+  return 1;
+}
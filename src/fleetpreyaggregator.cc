@@ -13,7 +13,7 @@ FleetPreyAggregator::FleetPreyAggregator(const FleetPtrVector& Fleets,
   : LgrpDiv(Lgrpdiv), areas(Areas), ages(Ages), overconsumption(overcons),
     doescatch(Fleets.Size(), Stocks.Size(), 0), suitptr(0), alptr(0) {
 
-  int i, j;
+  int f, g, h, i, j, k, r, numlen;
   //JMB its simpler to just store pointers to the predators
   //and preys rather than pointers to the fleets and stocks
   for (i = 0; i < Stocks.Size(); i++)
@@ -38,6 +38,37 @@ FleetPreyAggregator::FleetPreyAggregator(const FleetPtrVector& Fleets,
   PopInfoMatrix popmatrix(ages.Nrow(), LgrpDiv->numLengthGroups(), tmppop);
   total.resize(areas.Nrow(), 0, 0, popmatrix);
   this->Reset();
+
+  //the structure of the aggregation doesn't change, so find the entries to be added now
+  //each fleet, stock and area is added as a separate group, since the ratio used can be different
+  //and the stock might not be available to be caught on that area during the simulation
+  for (f = 0; f < predators.Size(); f++) {
+    for (h = 0; h < preys.Size(); h++) {
+      if (doescatch[f][h]) {
+        for (r = 0; r < areas.Nrow(); r++) {
+          for (j = 0; j < areas.Ncol(r); j++) {
+            if ((preys[h]->isInArea(areas[r][j])) && (predators[f]->isInArea(areas[r][j]))) {
+              for (i = 0; i < predators[f]->numPreys(); i++) {
+                if (strcasecmp(preys[h]->getName(), predators[f]->getPrey(i)->getName()) == 0) {
+                  plan.addGroup();
+                  grouppred.resize(1, f);
+                  groupstock.resize(1, h);
+                  groupprey.resize(1, i);
+                  grouparea.resize(1, areas[r][j]);
+                  alptr = &((StockPrey*)preys[h])->getConsumptionALK(areas[r][j]);
+                  numlen = preys[h]->getLengthGroupDiv()->numLengthGroups();
+                  for (g = 0; g < ages.Nrow(); g++)
+                    for (k = 0; k < ages.Ncol(g); k++)
+                      if ((alptr->minAge() <= ages[g][k]) && (ages[g][k] <= alptr->maxAge()))
+                        plan.addEntries(total[r][g], (*alptr)[ages[g][k]], *CI[h], numlen);
+                }
+              }
+            }
+          }
+        }
+      }
+    }
+  }
 }
 
 FleetPreyAggregator::~FleetPreyAggregator() {
@@ -80,40 +111,27 @@ int FleetPreyAggregator::checkCatchData() {
 
 void FleetPreyAggregator::Sum() {
 
-  int f, g, h, i, j, k, r, z;
+  int f, h, i, n, area;
   int predl = 0;  //JMB there is only ever one length group ...
   double ratio;
 
   this->Reset();
   //Sum over the appropriate predators, preys, areas, ages and length groups
-  for (f = 0; f < predators.Size(); f++) {
-    for (h = 0; h < preys.Size(); h++) {
-      if (doescatch[f][h]) {
-        for (r = 0; r < areas.Nrow(); r++) {
-          for (j = 0; j < areas.Ncol(r); j++) {
-            if ((preys[h]->isPreyArea(areas[r][j])) && (predators[f]->isInArea(areas[r][j]))) {
-              for (i = 0; i < predators[f]->numPreys(); i++) {
-                if (strcasecmp(preys[h]->getName(), predators[f]->getPrey(i)->getName()) == 0) {
-
-                  //JMB cleaned up the overconsumption stuff
-                  if (overconsumption)
-                    suitptr = &((PopPredator*)predators[f])->getUseSuitability(areas[r][j], i)[predl];
-                  else
-                    suitptr = &predators[f]->getSuitability(i)[predl];
-
-                  alptr = &((StockPrey*)preys[h])->getConsumptionALK(areas[r][j]);
-                  ratio = predators[f]->getConsumptionRatio(areas[r][j], i, predl);
-                  for (g = 0; g < ages.Nrow(); g++)
-                    for (k = 0; k < ages.Ncol(g); k++)
-                      if ((alptr->minAge() <= ages[g][k]) && (ages[g][k] <= alptr->maxAge()))
-                        total[r][g].Add((*alptr)[ages[g][k]], *CI[h], *suitptr, ratio);
-
-                }
-              }
-            }
-          }
-        }
-      }
-    }
+  for (n = 0; n < plan.numGroups(); n++) {
+    f = grouppred[n];
+    h = groupstock[n];
+    i = groupprey[n];
+    area = grouparea[n];
+    if (!(preys[h]->isPreyArea(area)))
+      continue;
+
+    //JMB cleaned up the overconsumption stuff
+    if (overconsumption)
+      suitptr = &((PopPredator*)predators[f])->getUseSuitability(area, i)[predl];
+    else
+      suitptr = &predators[f]->getSuitability(i)[predl];
+
+    ratio = predators[f]->getConsumptionRatio(area, i, predl);
+    plan.Sum(n, *suitptr, ratio);
   }
 }
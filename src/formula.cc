@@ -5,12 +5,14 @@
 #include "global.h"
 
 Formula::Formula() {
+  owner = 0;
   value = 0.0;
   type = CONSTANT;
   functiontype = NONE;
 }
 
 Formula::Formula(double initial) {
+  owner = 0;
   value = initial;
   type = CONSTANT;
   functiontype = NONE;
@@ -26,6 +28,7 @@ Formula::Formula(FunctionType ft, vector<Formula*> formlist) {
   if (formlist.size() <= 0)
     handle.logMessage(LOGFAIL, "Error in formula - no formula given in parameter list");
 
+  owner = 0;
   value = 0.0;
   type = FUNCTION;
   functiontype = ft;
@@ -39,7 +42,11 @@ Formula::Formula(FunctionType ft, vector<Formula*> formlist) {
 Formula::operator double() const {
   switch (type) {
     case CONSTANT:
+      return value;
+      break;
     case PARAMETER:
+      if ((owner != 0) && (owner->isTracing()))
+        owner->traceVariable(&value);
       return value;
       break;
     case FUNCTION:
@@ -252,6 +259,7 @@ double Formula::evalFunction() const {
 }
 
 Formula::Formula(const Formula& initial) {
+  owner = initial.owner;
   type = initial.type;
   value = initial.value;
   functiontype = initial.functiontype;
@@ -451,6 +459,7 @@ void Formula::Inform(Keeper* keeper) {
       break;
     case PARAMETER:
       // only one parameter
+      owner = keeper;
       keeper->keepVariable(value, name);
       break;
     case FUNCTION:
@@ -478,6 +487,7 @@ void Formula::Interchange(Formula& newF, Keeper* keeper) const {
 
     case PARAMETER:
       newF.name = name;
+      newF.owner = keeper;
       keeper->changeVariable(value, newF.value);
       break;
 
@@ -516,6 +526,7 @@ void Formula::Delete(Keeper* keeper) const {
 }
 
 Formula& Formula::operator = (const Formula& F) {
+  owner = F.owner;
   type = F.type;
   functiontype = F.functiontype;
   value = F.value;
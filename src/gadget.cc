@@ -7,12 +7,11 @@
 #include "interrupthandler.h"
 #include "global.h"
 
-Ecosystem* EcoSystem;
-
 
 int main(int aNumber, char* const aVector[]) {
 
   MainInfo main;
+  Ecosystem* EcoSystem = 0;
   StochasticData* data = 0;
   int check = 0;
 
@@ -62,7 +61,23 @@ int main(int aNumber, char* const aVector[]) {
     EcoSystem->writeInitialInformation((main.getPI()).getOutputFile());
 
   if (main.runStochastic()) {
-    if (main.runNetwork()) {
+    if ((main.runNetwork()) && (main.getSocketGiven())) {
+      if (main.getInitialParamGiven()) {
+        if (chdir(inputdir) != 0) //JMB need to change back to inputdir to read the file
+          handle.logMessage(LOGFAIL, "Error - failed to change input directory to", inputdir);
+        data = new StochasticData(main.getInitialParamFile());
+        if (chdir(workingdir) != 0)
+          handle.logMessage(LOGFAIL, "Error - failed to change working directory to", workingdir);
+
+        EcoSystem->Update(data);
+        EcoSystem->checkBounds();
+        delete data;
+      }
+
+      EcoSystem->Initialise();
+      EcoSystem->serveSocket(main.getSocketFile());
+
+    } else if (main.runNetwork()) {
 #ifdef GADGET_NETWORK //to help compiling when pvm libraries are unavailable
       EcoSystem->Initialise();
       data = new StochasticData();
@@ -95,14 +110,7 @@ int main(int aNumber, char* const aVector[]) {
       if ((main.getPI()).getPrint())
         EcoSystem->writeValues();
 
-      while (data->isDataLeft()) {
-        data->readNextLine();
-        EcoSystem->Update(data);
-        EcoSystem->checkBounds();
-        EcoSystem->Simulate(main.runPrint());
-        if ((main.getPI()).getPrint())
-          EcoSystem->writeValues();
-      }
+      EcoSystem->SimulateRepeatedValues(data, main.runPrint());
       delete data;
 
     } else {
@@ -149,6 +157,8 @@ int main(int aNumber, char* const aVector[]) {
   }
 
   handle.logMessage(LOGMESSAGE, "");  //write blank line to log file
+  if (main.getProfileGiven())
+    EcoSystem->writeProfile(main.getProfileFile());
   if (main.printFinal() && !(main.runNetwork()))
     EcoSystem->writeStatus(main.getPrintFinalFile());
 
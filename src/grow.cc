@@ -10,64 +10,68 @@
 
 /* JMB changed to deal with very small weights a bit better   */
 void AgeBandMatrix::Grow(const DoubleMatrix& Lgrowth, const DoubleMatrix& Wgrowth) {
-  int i, lgrp, grow, maxlgrp;
+  int i, lgrp, grow, maxlgrp, lower, numlen;
   double num, wt, tmp;
+  double *popN, *popW, *sumN, *sumW;
+  const double *lg, *wg;
 
   maxlgrp = Lgrowth.Nrow();
   for (i = 0; i < nrow; i++) {
     //the part that grows to or above the highest length group
     num = 0.0;
     wt = 0.0;
-    for (lgrp = v[i]->maxCol() - 1; lgrp >= v[i]->maxCol() - maxlgrp; lgrp--) {
-      for (grow = v[i]->maxCol() - lgrp - 1; grow < maxlgrp; grow++) {
-        tmp = Lgrowth[grow][lgrp] * (*v[i])[lgrp].N;
+    for (lgrp = v[i].maxCol() - 1; lgrp >= v[i].maxCol() - maxlgrp; lgrp--) {
+      for (grow = v[i].maxCol() - lgrp - 1; grow < maxlgrp; grow++) {
+        tmp = Lgrowth[grow][lgrp] * v[i][lgrp].N;
         num += tmp;
-        wt += tmp * (Wgrowth[grow][lgrp] + (*v[i])[lgrp].W);
+        wt += tmp * (Wgrowth[grow][lgrp] + v[i][lgrp].W);
       }
     }
 
-    lgrp = v[i]->maxCol() - 1;
-    if (isZero(num) || (wt < verysmall)) {
-      (*v[i])[lgrp].setToZero();
-    } else {
-      (*v[i])[lgrp].W = wt / num;
-      (*v[i])[lgrp].N = num;
-    }
-
-    //the central diagonal part of the length division
-    for (lgrp = v[i]->maxCol() - 2; lgrp >= v[i]->minCol() + maxlgrp - 1; lgrp--) {
-      num = 0.0;
-      wt = 0.0;
-      for (grow = 0; grow < maxlgrp; grow++) {
-        tmp = Lgrowth[grow][lgrp - grow] * (*v[i])[lgrp - grow].N;
-        num += tmp;
-        wt += tmp * (Wgrowth[grow][lgrp - grow] + (*v[i])[lgrp - grow].W);
+    //the rest of the length division is calculated as a banded convolution
+    //over the length groups for each growth step, using contiguous copies
+    //of the population so that the inner loop can be vectorised
+    lower = v[i].minCol();
+    numlen = v[i].Size() - 1;
+    if (numlen > 0) {
+      this->setGrowBuffer(4 * numlen);
+      popN = &growbuffer[0];
+      popW = popN + numlen;
+      sumN = popW + numlen;
+      sumW = sumN + numlen;
+      for (lgrp = 0; lgrp < numlen; lgrp++) {
+        popN[lgrp] = v[i][lgrp + lower].N;
+        popW[lgrp] = v[i][lgrp + lower].W;
+        sumN[lgrp] = 0.0;
+        sumW[lgrp] = 0.0;
       }
 
-      if (isZero(num) || (wt < verysmall)) {
-        (*v[i])[lgrp].setToZero();
-      } else {
-        (*v[i])[lgrp].W = wt / num;
-        (*v[i])[lgrp].N = num;
+      for (grow = 0; (grow < maxlgrp) && (grow < numlen); grow++) {
+        lg = &Lgrowth[grow][lower];
+        wg = &Wgrowth[grow][lower];
+        for (lgrp = grow; lgrp < numlen; lgrp++) {
+          tmp = lg[lgrp - grow] * popN[lgrp - grow];
+          sumN[lgrp] += tmp;
+          sumW[lgrp] += tmp * (wg[lgrp - grow] + popW[lgrp - grow]);
+        }
       }
-    }
 
-    //the lowest part of the length division
-    for (lgrp = v[i]->minCol() + maxlgrp - 2; lgrp >= v[i]->minCol(); lgrp--) {
-      num = 0.0;
-      wt = 0.0;
-      for (grow = 0; grow <= lgrp - v[i]->minCol(); grow++) {
-        tmp = Lgrowth[grow][lgrp - grow] * (*v[i])[lgrp - grow].N;
-        num += tmp;
-        wt += tmp * (Wgrowth[grow][lgrp - grow] + (*v[i])[lgrp - grow].W);
+      for (lgrp = 0; lgrp < numlen; lgrp++) {
+        if (isZero(sumN[lgrp]) || (sumW[lgrp] < verysmall)) {
+          v[i][lgrp + lower].setToZero();
+        } else {
+          v[i][lgrp + lower].W = sumW[lgrp] / sumN[lgrp];
+          v[i][lgrp + lower].N = sumN[lgrp];
+        }
       }
+    }
 
-      if (isZero(num) || (wt < verysmall)) {
-        (*v[i])[lgrp].setToZero();
-      } else {
-        (*v[i])[lgrp].W = wt / num;
-        (*v[i])[lgrp].N = num;
-      }
+    lgrp = v[i].maxCol() - 1;
+    if (isZero(num) || (wt < verysmall)) {
+      v[i][lgrp].setToZero();
+    } else {
+      v[i][lgrp].W = wt / num;
+      v[i][lgrp].N = num;
     }
   }
 }
@@ -75,155 +79,167 @@ void AgeBandMatrix::Grow(const DoubleMatrix& Lgrowth, const DoubleMatrix& Wgrowt
 //Same program with certain num of fish made mature.
 void AgeBandMatrix::Grow(const DoubleMatrix& Lgrowth, const DoubleMatrix& Wgrowth, Maturity* const Mat, int area) {
 
-  int i, lgrp, grow, maxlgrp, age;
+  int i, lgrp, grow, maxlgrp, age, lower, numlen;
   double num, wt, matnum, tmp, ratio;
+  double *popN, *popW, *sumN, *sumW, *sumM, *matN, *matW, *ratiotmp;
+  const double *lg, *wg, *rt;
+  const DoubleMatrix* table;
 
   maxlgrp = Lgrowth.Nrow();
   for (i = 0; i < nrow; i++) {
     age = i + minage;
+    //the maturation ratios are precalculated unless they depend on the weight
+    table = Mat->getMaturationTable(age, maxlgrp);
     num = 0.0;
     wt = 0.0;
     matnum = 0.0;
-    for (lgrp = v[i]->maxCol() - 1; lgrp >= v[i]->maxCol() - maxlgrp; lgrp--) {
-      for (grow = v[i]->maxCol() - lgrp - 1; grow < maxlgrp; grow++) {
-        ratio = Mat->calcMaturation(age, lgrp, grow, (*v[i])[lgrp].W);
-        tmp = Lgrowth[grow][lgrp] * (*v[i])[lgrp].N;
+    for (lgrp = v[i].maxCol() - 1; lgrp >= v[i].maxCol() - maxlgrp; lgrp--) {
+      for (grow = v[i].maxCol() - lgrp - 1; grow < maxlgrp; grow++) {
+        if (table == 0)
+          ratio = Mat->calcMaturation(age, lgrp, grow, v[i][lgrp].W);
+        else
+          ratio = (*table)[grow][lgrp];
+        tmp = Lgrowth[grow][lgrp] * v[i][lgrp].N;
         matnum += (tmp * ratio);
         num += tmp;
-        wt += tmp * (Wgrowth[grow][lgrp] + (*v[i])[lgrp].W);
+        wt += tmp * (Wgrowth[grow][lgrp] + v[i][lgrp].W);
+      }
+    }
+
+    lower = v[i].minCol();
+    numlen = v[i].Size() - 1;
+    if (numlen > 0) {
+      this->setGrowBuffer(8 * numlen);
+      popN = &growbuffer[0];
+      popW = popN + numlen;
+      sumN = popW + numlen;
+      sumW = sumN + numlen;
+      sumM = sumW + numlen;
+      matN = sumM + numlen;
+      matW = matN + numlen;
+      ratiotmp = matW + numlen;
+      for (lgrp = 0; lgrp < numlen; lgrp++) {
+        popN[lgrp] = v[i][lgrp + lower].N;
+        popW[lgrp] = v[i][lgrp + lower].W;
+        sumN[lgrp] = 0.0;
+        sumW[lgrp] = 0.0;
+        sumM[lgrp] = 0.0;
+      }
+
+      for (grow = 0; (grow < maxlgrp) && (grow < numlen); grow++) {
+        lg = &Lgrowth[grow][lower];
+        wg = &Wgrowth[grow][lower];
+        if (table == 0) {
+          for (lgrp = grow; lgrp < numlen; lgrp++)
+            ratiotmp[lgrp] = Mat->calcMaturation(age, lgrp + lower, grow, popW[lgrp - grow]);
+          rt = ratiotmp;
+        } else
+          rt = &(*table)[grow][lower];
+
+        for (lgrp = grow; lgrp < numlen; lgrp++) {
+          tmp = lg[lgrp - grow] * popN[lgrp - grow];
+          sumM[lgrp] += (tmp * rt[lgrp]);
+          sumN[lgrp] += tmp;
+          sumW[lgrp] += tmp * (wg[lgrp - grow] + popW[lgrp - grow]);
+        }
+      }
+
+      for (lgrp = 0; lgrp < numlen; lgrp++) {
+        if (isZero(sumN[lgrp]) || (sumW[lgrp] < verysmall)) {
+          //no fish grow to this length cell
+          v[i][lgrp + lower].setToZero();
+          matN[lgrp] = 0.0;
+          matW[lgrp] = 0.0;
+        } else if (isZero(sumM[lgrp])) {
+          //none of the fish that grow to this length cell mature
+          v[i][lgrp + lower].W = sumW[lgrp] / sumN[lgrp];
+          v[i][lgrp + lower].N = sumN[lgrp];
+          matN[lgrp] = 0.0;
+          matW[lgrp] = 0.0;
+        } else if (isEqual(sumN[lgrp], sumM[lgrp]) || (sumM[lgrp] > sumN[lgrp])) {
+          //all the fish that grow to this length cell mature
+          v[i][lgrp + lower].setToZero();
+          matN[lgrp] = sumN[lgrp];
+          matW[lgrp] = sumW[lgrp] / sumN[lgrp];
+        } else {
+          v[i][lgrp + lower].W = sumW[lgrp] / sumN[lgrp];
+          v[i][lgrp + lower].N = sumN[lgrp] - sumM[lgrp];
+          matN[lgrp] = sumM[lgrp];
+          matW[lgrp] = sumW[lgrp] / sumN[lgrp];
+        }
       }
+      Mat->storeMatureStock(area, age, lower, numlen, matN, matW);
     }
 
-    lgrp = v[i]->maxCol() - 1;
+    lgrp = v[i].maxCol() - 1;
     if (isZero(num) || (wt < verysmall)) {
       //no fish grow to this length cell
-      (*v[i])[lgrp].setToZero();
+      v[i][lgrp].setToZero();
       Mat->storeMatureStock(area, age, lgrp, 0.0, 0.0);
     } else if (isZero(matnum)) {
       //none of the fish that grow to this length cell mature
-      (*v[i])[lgrp].W = wt / num;
-      (*v[i])[lgrp].N = num;
+      v[i][lgrp].W = wt / num;
+      v[i][lgrp].N = num;
       Mat->storeMatureStock(area, age, lgrp, 0.0, 0.0);
     } else if (isEqual(num, matnum) || (matnum > num)) {
       //all the fish that grow to this length cell mature
-      (*v[i])[lgrp].setToZero();
+      v[i][lgrp].setToZero();
       Mat->storeMatureStock(area, age, lgrp, num, wt / num);
     } else {
-      (*v[i])[lgrp].W = wt / num;
-      (*v[i])[lgrp].N = num - matnum;
+      v[i][lgrp].W = wt / num;
+      v[i][lgrp].N = num - matnum;
       Mat->storeMatureStock(area, age, lgrp, matnum, wt / num);
     }
-
-    for (lgrp = v[i]->maxCol() - 2; lgrp >= v[i]->minCol() + maxlgrp - 1; lgrp--) {
-      num = 0.0;
-      wt = 0.0;
-      matnum = 0.0;
-      for (grow = 0; grow < maxlgrp; grow++) {
-        ratio = Mat->calcMaturation(age, lgrp, grow, (*v[i])[lgrp - grow].W);
-        tmp = Lgrowth[grow][lgrp - grow] * (*v[i])[lgrp - grow].N;
-        matnum += (tmp * ratio);
-        num += tmp;
-        wt += tmp * (Wgrowth[grow][lgrp - grow] + (*v[i])[lgrp - grow].W);
-      }
-
-      if (isZero(num) || (wt < verysmall)) {
-        //no fish grow to this length cell
-        (*v[i])[lgrp].setToZero();
-        Mat->storeMatureStock(area, age, lgrp, 0.0, 0.0);
-      } else if (isZero(matnum)) {
-        //none of the fish that grow to this length cell mature
-        (*v[i])[lgrp].W = wt / num;
-        (*v[i])[lgrp].N = num;
-        Mat->storeMatureStock(area, age, lgrp, 0.0, 0.0);
-      } else if (isEqual(num, matnum) || (matnum > num)) {
-        //all the fish that grow to this length cell mature
-        (*v[i])[lgrp].setToZero();
-        Mat->storeMatureStock(area, age, lgrp, num, wt / num);
-      } else {
-        (*v[i])[lgrp].W = wt / num;
-        (*v[i])[lgrp].N = num - matnum;
-        Mat->storeMatureStock(area, age, lgrp, matnum, wt / num);
-      }
-    }
-
-    for (lgrp = v[i]->minCol() + maxlgrp - 2; lgrp >= v[i]->minCol(); lgrp--) {
-      num = 0.0;
-      wt = 0.0;
-      matnum = 0.0;
-      for (grow = 0; grow <= lgrp - v[i]->minCol(); grow++) {
-        ratio = Mat->calcMaturation(age, lgrp, grow, (*v[i])[lgrp - grow].W);
-        tmp = Lgrowth[grow][lgrp - grow] * (*v[i])[lgrp - grow].N;
-        matnum += (tmp * ratio);
-        num += tmp;
-        wt += tmp * (Wgrowth[grow][lgrp - grow] + (*v[i])[lgrp - grow].W);
-      }
-
-      if (isZero(num) || (wt < verysmall)) {
-        //no fish grow to this length cell
-        (*v[i])[lgrp].setToZero();
-        Mat->storeMatureStock(area, age, lgrp, 0.0, 0.0);
-      } else if (isZero(matnum)) {
-        //none of the fish that grow to this length cell mature
-        (*v[i])[lgrp].W = wt / num;
-        (*v[i])[lgrp].N = num;
-        Mat->storeMatureStock(area, age, lgrp, 0.0, 0.0);
-      } else if (isEqual(num, matnum) || (matnum > num)) {
-        //all the fish that grow to this length cell mature
-        (*v[i])[lgrp].setToZero();
-        Mat->storeMatureStock(area, age, lgrp, num, wt / num);
-      } else {
-        (*v[i])[lgrp].W = wt / num;
-        (*v[i])[lgrp].N = num - matnum;
-        Mat->storeMatureStock(area, age, lgrp, matnum, wt / num);
-      }
-    }
   }
 }
 
 //fleksibest formulation - weight read in from file (should be positive)
 void AgeBandMatrix::Grow(const DoubleMatrix& Lgrowth, const DoubleVector& Weight) {
-  int i, lgrp, grow, maxlgrp;
+  int i, lgrp, grow, maxlgrp, lower, numlen;
   double num;
+  double *popN, *sumN;
+  const double* lg;
 
   maxlgrp = Lgrowth.Nrow();
   for (i = 0; i < nrow; i++) {
     num = 0.0;
-    for (lgrp = v[i]->maxCol() - 1; lgrp >= v[i]->maxCol() - maxlgrp; lgrp--)
-      for (grow = v[i]->maxCol() - lgrp - 1; grow < maxlgrp; grow++)
-        num += (Lgrowth[grow][lgrp] * (*v[i])[lgrp].N);
+    for (lgrp = v[i].maxCol() - 1; lgrp >= v[i].maxCol() - maxlgrp; lgrp--)
+      for (grow = v[i].maxCol() - lgrp - 1; grow < maxlgrp; grow++)
+        num += (Lgrowth[grow][lgrp] * v[i][lgrp].N);
 
-    lgrp = v[i]->maxCol() - 1;
-    if (isZero(num)) {
-      (*v[i])[lgrp].setToZero();
-    } else {
-      (*v[i])[lgrp].N = num;
-      (*v[i])[lgrp].W = Weight[lgrp];
-    }
+    lower = v[i].minCol();
+    numlen = v[i].Size() - 1;
+    if (numlen > 0) {
+      this->setGrowBuffer(2 * numlen);
+      popN = &growbuffer[0];
+      sumN = popN + numlen;
+      for (lgrp = 0; lgrp < numlen; lgrp++) {
+        popN[lgrp] = v[i][lgrp + lower].N;
+        sumN[lgrp] = 0.0;
+      }
 
-    for (lgrp = v[i]->maxCol() - 2; lgrp >= v[i]->minCol() + maxlgrp - 1; lgrp--) {
-      num = 0.0;
-      for (grow = 0; grow < maxlgrp; grow++)
-        num += (Lgrowth[grow][lgrp - grow] * (*v[i])[lgrp - grow].N);
+      for (grow = 0; (grow < maxlgrp) && (grow < numlen); grow++) {
+        lg = &Lgrowth[grow][lower];
+        for (lgrp = grow; lgrp < numlen; lgrp++)
+          sumN[lgrp] += (lg[lgrp - grow] * popN[lgrp - grow]);
+      }
 
-      if (isZero(num)) {
-        (*v[i])[lgrp].setToZero();
-      } else {
-        (*v[i])[lgrp].N = num;
-        (*v[i])[lgrp].W = Weight[lgrp];
+      for (lgrp = 0; lgrp < numlen; lgrp++) {
+        if (isZero(sumN[lgrp])) {
+          v[i][lgrp + lower].setToZero();
+        } else {
+          v[i][lgrp + lower].N = sumN[lgrp];
+          v[i][lgrp + lower].W = Weight[lgrp + lower];
+        }
       }
     }
 
-    for (lgrp = v[i]->minCol() + maxlgrp - 2; lgrp >= v[i]->minCol(); lgrp--) {
-      num = 0.0;
-      for (grow = 0; grow <= lgrp - v[i]->minCol(); grow++)
-        num += (Lgrowth[grow][lgrp - grow] * (*v[i])[lgrp - grow].N);
-
-      if (isZero(num)) {
-        (*v[i])[lgrp].setToZero();
-      } else {
-        (*v[i])[lgrp].N = num;
-        (*v[i])[lgrp].W = Weight[lgrp];
-      }
+    lgrp = v[i].maxCol() - 1;
+    if (isZero(num)) {
+      v[i][lgrp].setToZero();
+    } else {
+      v[i][lgrp].N = num;
+      v[i][lgrp].W = Weight[lgrp];
     }
   }
 }
@@ -232,101 +248,110 @@ void AgeBandMatrix::Grow(const DoubleMatrix& Lgrowth, const DoubleVector& Weight
 //Same program with certain num of fish made mature.
 void AgeBandMatrix::Grow(const DoubleMatrix& Lgrowth, const DoubleVector& Weight, Maturity* const Mat, int area) {
 
-  int i, lgrp, grow, maxlgrp, age;
+  int i, lgrp, grow, maxlgrp, age, lower, numlen;
   double num, matnum, tmp, ratio;
+  double *popN, *popW, *sumN, *sumM, *matN, *matW, *ratiotmp;
+  const double *lg, *rt;
+  const DoubleMatrix* table;
 
   maxlgrp = Lgrowth.Nrow();
   for (i = 0; i < nrow; i++) {
     age = i + minage;
+    //the maturation ratios are precalculated unless they depend on the weight
+    table = Mat->getMaturationTable(age, maxlgrp);
     num = 0.0;
     matnum = 0.0;
-    for (lgrp = v[i]->maxCol() - 1; lgrp >= v[i]->maxCol() - maxlgrp; lgrp--) {
-      for (grow = v[i]->maxCol() - lgrp - 1; grow < maxlgrp; grow++) {
-        ratio = Mat->calcMaturation(age, lgrp, grow, (*v[i])[lgrp].W);
-        tmp = Lgrowth[grow][lgrp] * (*v[i])[lgrp].N;
+    for (lgrp = v[i].maxCol() - 1; lgrp >= v[i].maxCol() - maxlgrp; lgrp--) {
+      for (grow = v[i].maxCol() - lgrp - 1; grow < maxlgrp; grow++) {
+        if (table == 0)
+          ratio = Mat->calcMaturation(age, lgrp, grow, v[i][lgrp].W);
+        else
+          ratio = (*table)[grow][lgrp];
+        tmp = Lgrowth[grow][lgrp] * v[i][lgrp].N;
         matnum += (tmp * ratio);
         num += tmp;
       }
     }
 
-    lgrp = v[i]->maxCol() - 1;
+    lower = v[i].minCol();
+    numlen = v[i].Size() - 1;
+    if (numlen > 0) {
+      this->setGrowBuffer(7 * numlen);
+      popN = &growbuffer[0];
+      popW = popN + numlen;
+      sumN = popW + numlen;
+      sumM = sumN + numlen;
+      matN = sumM + numlen;
+      matW = matN + numlen;
+      ratiotmp = matW + numlen;
+      for (lgrp = 0; lgrp < numlen; lgrp++) {
+        popN[lgrp] = v[i][lgrp + lower].N;
+        popW[lgrp] = v[i][lgrp + lower].W;
+        sumN[lgrp] = 0.0;
+        sumM[lgrp] = 0.0;
+      }
+
+      for (grow = 0; (grow < maxlgrp) && (grow < numlen); grow++) {
+        lg = &Lgrowth[grow][lower];
+        if (table == 0) {
+          for (lgrp = grow; lgrp < numlen; lgrp++)
+            ratiotmp[lgrp] = Mat->calcMaturation(age, lgrp + lower, grow, popW[lgrp - grow]);
+          rt = ratiotmp;
+        } else
+          rt = &(*table)[grow][lower];
+
+        for (lgrp = grow; lgrp < numlen; lgrp++) {
+          tmp = lg[lgrp - grow] * popN[lgrp - grow];
+          sumM[lgrp] += (tmp * rt[lgrp]);
+          sumN[lgrp] += tmp;
+        }
+      }
+
+      for (lgrp = 0; lgrp < numlen; lgrp++) {
+        if (isZero(sumN[lgrp])) {
+          //no fish grow to this length cell
+          v[i][lgrp + lower].setToZero();
+          matN[lgrp] = 0.0;
+          matW[lgrp] = 0.0;
+        } else if (isZero(sumM[lgrp])) {
+          //none of the fish that grow to this length cell mature
+          v[i][lgrp + lower].W = Weight[lgrp + lower];
+          v[i][lgrp + lower].N = sumN[lgrp];
+          matN[lgrp] = 0.0;
+          matW[lgrp] = 0.0;
+        } else if (isEqual(sumN[lgrp], sumM[lgrp]) || (sumM[lgrp] > sumN[lgrp])) {
+          //all the fish that grow to this length cell mature
+          v[i][lgrp + lower].setToZero();
+          matN[lgrp] = sumN[lgrp];
+          matW[lgrp] = Weight[lgrp + lower];
+        } else {
+          v[i][lgrp + lower].W = Weight[lgrp + lower];
+          v[i][lgrp + lower].N = sumN[lgrp] - sumM[lgrp];
+          matN[lgrp] = sumM[lgrp];
+          matW[lgrp] = Weight[lgrp + lower];
+        }
+      }
+      Mat->storeMatureStock(area, age, lower, numlen, matN, matW);
+    }
+
+    lgrp = v[i].maxCol() - 1;
     if (isZero(num)) {
       //no fish grow to this length cell
-      (*v[i])[lgrp].setToZero();
+      v[i][lgrp].setToZero();
       Mat->storeMatureStock(area, age, lgrp, 0.0, 0.0);
     } else if (isZero(matnum)) {
       //none of the fish that grow to this length cell mature
-      (*v[i])[lgrp].W = Weight[lgrp];
-      (*v[i])[lgrp].N = num;
+      v[i][lgrp].W = Weight[lgrp];
+      v[i][lgrp].N = num;
       Mat->storeMatureStock(area, age, lgrp, 0.0, 0.0);
     } else if (isEqual(num, matnum) || (matnum > num)) {
       //all the fish that grow to this length cell mature
-      (*v[i])[lgrp].setToZero();
+      v[i][lgrp].setToZero();
       Mat->storeMatureStock(area, age, lgrp, num, Weight[lgrp]);
     } else {
-      (*v[i])[lgrp].W = Weight[lgrp];
-      (*v[i])[lgrp].N = num - matnum;
+      v[i][lgrp].W = Weight[lgrp];
+      v[i][lgrp].N = num - matnum;
       Mat->storeMatureStock(area, age, lgrp, matnum, Weight[lgrp]);
     }
-
-    for (lgrp = v[i]->maxCol() - 2; lgrp >= v[i]->minCol() + maxlgrp - 1; lgrp--) {
-      num = 0.0;
-      matnum = 0.0;
-      for (grow = 0; grow < maxlgrp; grow++) {
-        ratio = Mat->calcMaturation(age, lgrp, grow, (*v[i])[lgrp - grow].W);
-        tmp = Lgrowth[grow][lgrp - grow] * (*v[i])[lgrp - grow].N;
-        matnum += (tmp * ratio);
-        num += tmp;
-      }
-
-      if (isZero(num)) {
-        //no fish grow to this length cell
-        (*v[i])[lgrp].setToZero();
-        Mat->storeMatureStock(area, age, lgrp, 0.0, 0.0);
-      } else if (isZero(matnum)) {
-        //none of the fish that grow to this length cell mature
-        (*v[i])[lgrp].W = Weight[lgrp];
-        (*v[i])[lgrp].N = num;
-        Mat->storeMatureStock(area, age, lgrp, 0.0, 0.0);
-      } else if (isEqual(num, matnum) || (matnum > num)) {
-        //all the fish that grow to this length cell mature
-        (*v[i])[lgrp].setToZero();
-        Mat->storeMatureStock(area, age, lgrp, num, Weight[lgrp]);
-      } else {
-        (*v[i])[lgrp].W = Weight[lgrp];
-        (*v[i])[lgrp].N = num - matnum;
-        Mat->storeMatureStock(area, age, lgrp, matnum, Weight[lgrp]);
-      }
-    }
-
-    for (lgrp = v[i]->minCol() + maxlgrp - 2; lgrp >= v[i]->minCol(); lgrp--) {
-      num = 0.0;
-      matnum = 0.0;
-      for (grow = 0; grow <= lgrp - v[i]->minCol(); grow++) {
-        ratio = Mat->calcMaturation(age, lgrp, grow, (*v[i])[lgrp - grow].W);
-        tmp = Lgrowth[grow][lgrp - grow] * (*v[i])[lgrp - grow].N;
-        matnum += (tmp * ratio);
-        num += tmp;
-      }
-
-      if (isZero(num)) {
-        //no fish grow to this length cell
-        (*v[i])[lgrp].setToZero();
-        Mat->storeMatureStock(area, age, lgrp, 0.0, 0.0);
-      } else if (isZero(matnum)) {
-        //none of the fish that grow to this length cell mature
-        (*v[i])[lgrp].W = Weight[lgrp];
-        (*v[i])[lgrp].N = num;
-        Mat->storeMatureStock(area, age, lgrp, 0.0, 0.0);
-      } else if (isEqual(num, matnum) || (matnum > num)) {
-        //all the fish that grow to this length cell mature
-        (*v[i])[lgrp].setToZero();
-        Mat->storeMatureStock(area, age, lgrp, num, Weight[lgrp]);
-      } else {
-        (*v[i])[lgrp].W = Weight[lgrp];
-        (*v[i])[lgrp].N = num - matnum;
-        Mat->storeMatureStock(area, age, lgrp, matnum, Weight[lgrp]);
-      }
-    }
   }
 }
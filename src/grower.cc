@@ -108,6 +108,16 @@ Grower::Grower(CommentStream& infile, const LengthGroupDivision* const OtherLgrp
     lgrowth.resize(new DoubleMatrix(maxlengthgroupgrowth + 1, otherlen, 0.0));
     wgrowth.resize(new DoubleMatrix(maxlengthgroupgrowth + 1, otherlen, 0.0));
   }
+
+  //setting storage spaces for the cached growth distributions
+  cachevalid = 0;
+  cachebeta = 0.0;
+  lgrowthcache.AddRows(maxlengthgroupgrowth + 1, otherlen, 0.0);
+  lgrowthkey.AddRows(noareas, otherlen, -1.0);
+  cachegrowth.resize(otherlen, -1.0);
+  wgrowthset.resize(noareas, 0);
+  wgrowthmult.resize(noareas, 0.0);
+  wgrowthpower.resize(noareas, 0.0);
 }
 
 Grower::~Grower() {
@@ -197,6 +207,7 @@ void Grower::Reset() {
   calcLengthGrowth.setToZero();
   calcWeightGrowth.setToZero();
   interpLengthGrowth.setToZero();
+  cachevalid = 0;
   for (area = 0; area < areas.Size(); area++) {
     (*lgrowth[area]).setToZero();
     for (i = 0; i < LgrpDiv->numLengthGroups(); i++)
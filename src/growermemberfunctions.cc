@@ -9,30 +9,26 @@ void Grower::implementGrowth(int area, const PopInfoVector& NumberInArea,
   const LengthGroupDivision* const Lengths) {
 
   int lgroup, j, inarea = this->areaNum(area);
-  double meanw, tmppart3, tmpweight;
+  double meanw, tmpweight;
   double tmpMult = growthcalc->getMult();
   double tmpPower = growthcalc->getPower();
   double tmpDl = 1.0 / Lengths->dl();  //JMB no need to check zero here
 
+  this->checkGrowthCache();
+  //the weight increase for these growth functions only depends on the
+  //growth parameters, so it is only recalculated when they have changed
+  int calcweight = ((wgrowthset[inarea] == 0) || (tmpMult != wgrowthmult[inarea]) || (tmpPower != wgrowthpower[inarea]));
+  wgrowthset[inarea] = 1;
+  wgrowthmult[inarea] = tmpMult;
+  wgrowthpower[inarea] = tmpPower;
+
   for (lgroup = 0; lgroup < Lengths->numLengthGroups(); lgroup++) {
-    part3 = 1.0;
     growth = interpLengthGrowth[inarea][lgroup] * tmpDl;
     if (growth >= maxlengthgroupgrowth)
       growth = double(maxlengthgroupgrowth) - 0.1;
     if (growth < verysmall)
       growth = 0.0;
-    alpha = beta * growth / (maxlengthgroupgrowth - growth);
-    for (j = 0; j < maxlengthgroupgrowth; j++)
-      part3 *= (alpha + beta + double(j));
-
-    tmppart3 = 1.0 / part3;
-    part4[1] = alpha;
-    if (maxlengthgroupgrowth > 1)
-      for (j = 2; j <= maxlengthgroupgrowth; j++)
-        part4[j] = part4[j - 1] * (j - 1 + alpha);
-
-    for (j = 0; j <= maxlengthgroupgrowth; j++)
-      (*lgrowth[inarea])[j][lgroup] = part1[j] * part2[j] * tmppart3 * part4[j];
+    this->setLengthGrowth(inarea, lgroup);
 
     switch (functionnumber) {
       case 1:
@@ -57,7 +53,7 @@ void Grower::implementGrowth(int area, const PopInfoVector& NumberInArea,
       case 8:
       case 10:
       case 11:
-        if (lgroup != Lengths->numLengthGroups())
+        if ((calcweight) && (lgroup != Lengths->numLengthGroups()))
           for (j = 1; j <= maxlengthgroupgrowth; j++)
             (*wgrowth[inarea])[j][lgroup] = tmpMult * (pow(Lengths->meanLength(lgroup + j), tmpPower) - pow(Lengths->meanLength(lgroup), tmpPower));
         break;
@@ -71,17 +67,49 @@ void Grower::implementGrowth(int area, const PopInfoVector& NumberInArea,
 //Uses only the length increase in interpLengthGrowth to calculate lgrowth.
 void Grower::implementGrowth(int area, const LengthGroupDivision* const Lengths) {
 
-  int lgroup, j, inarea = this->areaNum(area);
-  double tmppart3;
+  int lgroup, inarea = this->areaNum(area);
   double tmpDl = 1.0 / Lengths->dl();  //JMB no need to check zero here
 
+  this->checkGrowthCache();
   for (lgroup = 0; lgroup < Lengths->numLengthGroups(); lgroup++) {
-    part3 = 1.0;
     growth = interpLengthGrowth[inarea][lgroup] * tmpDl;
     if (growth >= maxlengthgroupgrowth)
       growth = double(maxlengthgroupgrowth) - 0.1;
     if (growth < verysmall)
       growth = 0.0;
+    this->setLengthGrowth(inarea, lgroup);
+  }
+}
+
+void Grower::checkGrowthCache() {
+  //the cached distributions depend on beta, so clear them if beta has changed
+  if ((cachevalid) && (cachebeta == beta))
+    return;
+
+  int i, j;
+  for (i = 0; i < lgrowthkey.Nrow(); i++)
+    for (j = 0; j < lgrowthkey.Ncol(i); j++)
+      lgrowthkey[i][j] = -1.0;
+  for (j = 0; j < cachegrowth.Size(); j++)
+    cachegrowth[j] = -1.0;
+  cachebeta = beta;
+  cachevalid = 1;
+}
+
+//Set the beta binomial distribution for the mean growth (in length groups)
+//given by growth in the lgrowth matrix for the area.  The distribution for
+//each length group is cached and shared between the areas, and the exact
+//values of growth are used as keys so the results are always identical to
+//those calculated from scratch.
+void Grower::setLengthGrowth(int inarea, int lgroup) {
+  int j;
+  double tmppart3;
+
+  if (growth == lgrowthkey[inarea][lgroup])
+    return;  //this area already has the distribution for this growth
+
+  if (growth != cachegrowth[lgroup]) {
+    part3 = 1.0;
     alpha = beta * growth / (maxlengthgroupgrowth - growth);
     for (j = 0; j < maxlengthgroupgrowth; j++)
       part3 *= (alpha + beta + double(j));
@@ -93,6 +121,11 @@ void Grower::implementGrowth(int area, const LengthGroupDivision* const Lengths)
         part4[j] = part4[j - 1] * (j - 1 + alpha);
 
     for (j = 0; j <= maxlengthgroupgrowth; j++)
-      (*lgrowth[inarea])[j][lgroup] = part1[j] * part2[j] * tmppart3 * part4[j];
+      lgrowthcache[j][lgroup] = part1[j] * part2[j] * tmppart3 * part4[j];
+    cachegrowth[lgroup] = growth;
   }
+
+  for (j = 0; j <= maxlengthgroupgrowth; j++)
+    (*lgrowth[inarea])[j][lgroup] = lgrowthcache[j][lgroup];
+  lgrowthkey[inarea][lgroup] = growth;
 }
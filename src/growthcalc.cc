@@ -4,6 +4,7 @@
 #include "keeper.h"
 #include "readfunc.h"
 #include "readword.h"
+#include "mathfunc.h"
 #include "gadget.h"
 #include "global.h"
 
@@ -13,6 +14,28 @@
 GrowthCalcBase::GrowthCalcBase(const IntVector& Areas) : LivesOnAreas(Areas) {
 }
 
+const double* GrowthCalcBase::calcLengthPower(const LengthGroupDivision* const LgrpDiv, double power) {
+  int i, numlen = LgrpDiv->numLengthGroups();
+  if (lengthpower.Size() < numlen)
+    lengthpower.resize(numlen - lengthpower.Size(), 0.0);
+  for (i = 0; i < numlen; i++)
+    lengthpower[i] = LgrpDiv->meanLength(i);
+  calcPowVector(&lengthpower[0], &lengthpower[0], power, numlen);
+  return &lengthpower[0];
+}
+
+const double* GrowthCalcBase::calcWeightPower(const PopInfoVector& numGrow,
+  double scale, double power, DoubleVector& result) {
+
+  int i, numlen = numGrow.Size();
+  if (result.Size() < numlen)
+    result.resize(numlen - result.Size(), 0.0);
+  for (i = 0; i < numlen; i++)
+    result[i] = numGrow[i].W / scale;
+  calcPowVector(&result[0], &result[0], power, numlen);
+  return &result[0];
+}
+
 // ********************************************************
 // Functions for GrowthCalcA
 // ********************************************************
@@ -44,15 +67,17 @@ void GrowthCalcA::calcGrowth(int area, DoubleVector& Lgrowth, DoubleVector& Wgro
       (growthPar[7] * Area->getTemperature(area, TimeInfo->getTime()) + growthPar[8]);
 
   int i;
+  const double* lenpow = this->calcLengthPower(LgrpDiv, growthPar[1]);
+  const double* wpow = this->calcWeightPower(numGrow, 1.0, growthPar[5], weightpower);
   for (i = 0; i < Lgrowth.Size(); i++) {
-    Lgrowth[i] = tempL * pow(LgrpDiv->meanLength(i), growthPar[1]) * Fphi[i];
+    Lgrowth[i] = tempL * lenpow[i] * Fphi[i];
     if (Lgrowth[i] < 0.0)
       Lgrowth[i] = 0.0;
 
     if (numGrow[i].W < verysmall || isZero(tempW))
       Wgrowth[i] = 0.0;
     else
-      Wgrowth[i] = tempW * pow(numGrow[i].W, growthPar[5]) * (Fphi[i] - growthPar[6]);
+      Wgrowth[i] = tempW * wpow[i] * (Fphi[i] - growthPar[6]);
   }
 }
 
@@ -216,13 +241,15 @@ void GrowthCalcC::calcGrowth(int area, DoubleVector& Lgrowth, DoubleVector& Wgro
   double tempW = TimeInfo->getTimeStepSize() * wgrowthPar[0] *
       exp(wgrowthPar[1] * Area->getTemperature(area, TimeInfo->getTime()));
 
+  const double* lenpow = this->calcLengthPower(LgrpDiv, lgrowthPar[7] - 1.0);
+  const double* wpow = this->calcWeightPower(numGrow, wgrowthPar[2], wgrowthPar[4], weightpower);
+  const double* wpow2 = this->calcWeightPower(numGrow, wgrowthPar[3], wgrowthPar[5], weightpower2);
   for (i = 0; i < Wgrowth.Size(); i++) {
     if (numGrow[i].W < verysmall || isZero(tempW)) {
       Wgrowth[i] = 0.0;
       Lgrowth[i] = 0.0;
     } else {
-      Wgrowth[i] = tempW * (pow(numGrow[i].W / wgrowthPar[2], wgrowthPar[4]) -
-        pow(numGrow[i].W / wgrowthPar[3], wgrowthPar[5]));
+      Wgrowth[i] = tempW * (wpow[i] - wpow2[i]);
 
       if (Wgrowth[i] < verysmall) {
         Wgrowth[i] = 0.0;
@@ -234,8 +261,7 @@ void GrowthCalcC::calcGrowth(int area, DoubleVector& Lgrowth, DoubleVector& Wgro
         if (fx < verysmall)
           Lgrowth[i] = 0.0;
         else
-          Lgrowth[i] = fx * Wgrowth[i] / (lgrowthPar[6] * lgrowthPar[7] *
-            pow(LgrpDiv->meanLength(i), lgrowthPar[7] - 1.0));
+          Lgrowth[i] = fx * Wgrowth[i] / (lgrowthPar[6] * lgrowthPar[7] * lenpow[i]);
       }
     }
   }
@@ -332,13 +358,15 @@ void GrowthCalcD::calcGrowth(int area, DoubleVector& Lgrowth, DoubleVector& Wgro
   double tempW = TimeInfo->getTimeStepSize() * wgrowthPar[2] *
       exp(wgrowthPar[4] * Area->getTemperature(area, TimeInfo->getTime()) + wgrowthPar[5]);
 
+  const double* lenpow = this->calcLengthPower(LgrpDiv, lgrowthPar[7] - 1.0);
+  const double* wpow = this->calcWeightPower(numGrow, 1.0, wgrowthPar[1], weightpower);
+  const double* wpow2 = this->calcWeightPower(numGrow, 1.0, wgrowthPar[3], weightpower2);
   for (i = 0; i < Wgrowth.Size(); i++) {
     if (numGrow[i].W < verysmall) {
       Wgrowth[i] = 0.0;
       Lgrowth[i] = 0.0;
     } else {
-      Wgrowth[i] = Fphi[i] * MaxCon[i] * tempC / (pow(numGrow[i].W, wgrowthPar[1])) -
-        tempW * pow(numGrow[i].W, wgrowthPar[3]);
+      Wgrowth[i] = Fphi[i] * MaxCon[i] * tempC / wpow[i] - tempW * wpow2[i];
 
       if (Wgrowth[i] < verysmall) {
         Wgrowth[i] = 0.0;
@@ -351,8 +379,7 @@ void GrowthCalcD::calcGrowth(int area, DoubleVector& Lgrowth, DoubleVector& Wgro
         if (fx < verysmall)
           Lgrowth[i] = 0.0;
         else
-          Lgrowth[i] = fx * Wgrowth[i] / (lgrowthPar[6] * lgrowthPar[7] *
-            pow(LgrpDiv->meanLength(i), lgrowthPar[7] - 1.0));
+          Lgrowth[i] = fx * Wgrowth[i] / (lgrowthPar[6] * lgrowthPar[7] * lenpow[i]);
       }
     }
   }
@@ -482,13 +509,15 @@ void GrowthCalcE::calcGrowth(int area, DoubleVector& Lgrowth, DoubleVector& Wgro
   double tempW = factor * TimeInfo->getTimeStepSize() * wgrowthPar[0] *
       exp(wgrowthPar[1] * Area->getTemperature(area, TimeInfo->getTime()));
 
+  const double* lenpow = this->calcLengthPower(LgrpDiv, lgrowthPar[7] - 1.0);
+  const double* wpow = this->calcWeightPower(numGrow, wgrowthPar[2], wgrowthPar[4], weightpower);
+  const double* wpow2 = this->calcWeightPower(numGrow, wgrowthPar[3], wgrowthPar[5], weightpower2);
   for (i = 0; i < Wgrowth.Size(); i++) {
     if (numGrow[i].W < verysmall || isZero(tempW)) {
       Wgrowth[i] = 0.0;
       Lgrowth[i] = 0.0;
     } else {
-      Wgrowth[i] = tempW * (pow(numGrow[i].W / wgrowthPar[2], wgrowthPar[4]) -
-        pow(numGrow[i].W / wgrowthPar[3], wgrowthPar[5]));
+      Wgrowth[i] = tempW * (wpow[i] - wpow2[i]);
 
       if (Wgrowth[i] < verysmall) {
         Wgrowth[i] = 0.0;
@@ -500,8 +529,7 @@ void GrowthCalcE::calcGrowth(int area, DoubleVector& Lgrowth, DoubleVector& Wgro
         if (fx < verysmall)
           Lgrowth[i] = 0.0;
         else
-          Lgrowth[i] = fx * Wgrowth[i] / (lgrowthPar[6] * lgrowthPar[7] *
-            pow(LgrpDiv->meanLength(i), lgrowthPar[7] - 1.0));
+          Lgrowth[i] = fx * Wgrowth[i] / (lgrowthPar[6] * lgrowthPar[7] * lenpow[i]);
       }
     }
   }
@@ -651,8 +679,9 @@ void GrowthCalcG::calcGrowth(int area, DoubleVector& Lgrowth, DoubleVector& Wgro
         handle.logMessage(LOGWARN, "Warning in growth calculation - weight growth parameter is negative");
     }
   } else {
+    const double* lenpow = this->calcLengthPower(LgrpDiv, growthPar[0]);
     for (i = 0; i < Lgrowth.Size(); i++) {
-      Lgrowth[i] = kval * pow(LgrpDiv->meanLength(i), growthPar[0]);
+      Lgrowth[i] = kval * lenpow[i];
       Wgrowth[i] = (*wgrowth[inarea])[t][i];
       if ((handle.getLogLevel() >= LOGWARN) && (Wgrowth[i] < 0.0))
         handle.logMessage(LOGWARN, "Warning in growth calculation - weight growth parameter is negative");
@@ -741,19 +770,20 @@ void GrowthCalcI::calcGrowth(int area, DoubleVector& Lgrowth, DoubleVector& Wgro
       exp(growthPar[3] * Area->getTemperature(area, TimeInfo->getTime()));
 
   int i;
+  const double* lenpow = this->calcLengthPower(LgrpDiv, growthPar[5] - 1.0);
+  const double* wpow = this->calcWeightPower(numGrow, 1.0, growthPar[2], weightpower);
   for (i = 0; i < Wgrowth.Size(); i++) {
     if (numGrow[i].W < verysmall) {
       Wgrowth[i] = 0.0;
       Lgrowth[i] = 0.0;
     } else {
-      Wgrowth[i] = tempC * Fphi[i] * MaxCon[i] - tempW * pow(numGrow[i].W, growthPar[2]);
+      Wgrowth[i] = tempC * Fphi[i] * MaxCon[i] - tempW * wpow[i];
 
       if (Wgrowth[i] < verysmall) {
         Wgrowth[i] = 0.0;
         Lgrowth[i] = 0.0;
       } else {
-        Lgrowth[i] = Wgrowth[i] / (growthPar[4] * growthPar[5] *
-          pow(LgrpDiv->meanLength(i), growthPar[5] - 1.0));
+        Lgrowth[i] = Wgrowth[i] / (growthPar[4] * growthPar[5] * lenpow[i]);
       }
     }
   }
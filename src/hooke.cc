@@ -139,34 +139,115 @@
 #include "ecosystem.h"
 #include "global.h"
 
-extern Ecosystem* EcoSystem;
-
 
 /* given a point, look for a better one nearby, one coord at a time */
 double OptInfoHooke::bestNearby(DoubleVector& delta, DoubleVector& point, double prevbest, IntVector& param) {
 
+  //the worker processes can only be used when the steps are evaluated in batches
+  if ((threads > 1) || (EcoSystem->getNumForks() > 0))
+    return this->bestNearbyParallel(delta, point, prevbest, param);
+
   double minf, ftmp;
   int i;
-  DoubleVector z(point);
+  nearby = point;
 
   minf = prevbest;
   for (i = 0; i < point.Size(); i++) {
-    z[param[i]] = point[param[i]] + delta[param[i]];
-    ftmp = EcoSystem->SimulateAndUpdate(z);
+    /* a point is only accepted if it is better than minf, so the */
+    /* model runs can be stopped once they are worse than minf    */
+    nearby[param[i]] = point[param[i]] + delta[param[i]];
+    ftmp = EcoSystem->SimulateAndUpdate(nearby, minf);
     if (ftmp < minf) {
       minf = ftmp;
     } else {
       delta[param[i]] = 0.0 - delta[param[i]];
-      z[param[i]] = point[param[i]] + delta[param[i]];
-      ftmp = EcoSystem->SimulateAndUpdate(z);
+      nearby[param[i]] = point[param[i]] + delta[param[i]];
+      ftmp = EcoSystem->SimulateAndUpdate(nearby, minf);
       if (ftmp < minf)
         minf = ftmp;
       else
-        z[param[i]] = point[param[i]];
+        nearby[param[i]] = point[param[i]];
     }
   }
 
   for (i = 0; i < point.Size(); i++)
+    point[i] = nearby[i];
+  return minf;
+}
+
+/* given a point, look for a better one nearby, a batch of coords at a time */
+/* both steps for each coord in the batch are evaluated at the same time  */
+double OptInfoHooke::bestNearbyParallel(DoubleVector& delta, DoubleVector& point, double prevbest, IntVector& param) {
+
+  double minf, ftmp, bestf;
+  int i, j, k, c, start, num, best, accepted;
+  int nvars = point.Size();
+  int batch = (max(threads, EcoSystem->getNumForks()) + 1) / 2;
+  DoubleVector z(point);
+  DoubleVector trialz(nvars);
+
+  minf = prevbest;
+  for (start = 0; start < nvars; start += batch) {
+    num = batch;
+    if (start + num > nvars)
+      num = nvars - start;
+
+    /* the +delta and -delta steps for each coord, all from the same point */
+    DoubleMatrix trial(2 * num, nvars, 0.0);
+    DoubleVector f(2 * num, 0.0);
+    for (k = 0; k < num; k++) {
+      c = param[start + k];
+      for (j = 0; j < nvars; j++) {
+        trial[2 * k][j] = z[j];
+        trial[2 * k + 1][j] = z[j];
+      }
+      trial[2 * k][c] = point[c] + delta[c];
+      trial[2 * k + 1][c] = point[c] - delta[c];
+    }
+    EcoSystem->SimulateAndUpdate(trial, f);
+
+    /* apply the same rules as the serial search, in the order of param */
+    best = -1;
+    bestf = minf;
+    accepted = 0;
+    for (j = 0; j < nvars; j++)
+      trialz[j] = z[j];
+    for (k = 0; k < num; k++) {
+      c = param[start + k];
+      if (f[2 * k] < minf)
+        ftmp = f[2 * k];
+      else {
+        delta[c] = 0.0 - delta[c];
+        ftmp = f[2 * k + 1];
+      }
+      if (ftmp < minf) {
+        trialz[c] = point[c] + delta[c];
+        accepted++;
+        if (ftmp < bestf) {
+          bestf = ftmp;
+          best = c;
+        }
+      }
+    }
+
+    if (accepted == 1) {
+      z[best] = trialz[best];
+      minf = bestf;
+    } else if (accepted > 1) {
+      /* only take all the accepted moves if that is better than the best one */
+      ftmp = EcoSystem->SimulateAndUpdate(trialz);
+      if (ftmp < bestf) {
+        for (j = 0; j < nvars; j++)
+          z[j] = trialz[j];
+        minf = ftmp;
+      } else {
+        z[best] = trialz[best];
+        minf = bestf;
+      }
+    }
+  }
+
+  for (i = 0; i < nvars; i++)
     point[i] = z[i];
   return minf;
 }
@@ -178,6 +259,10 @@ void OptInfoHooke::OptimiseLikelihood() {
   int    rchange, rcheck, rnumber;  //Used to randomise the order of the parameters
 
   handle.logMessage(LOGINFO, "\nStarting Hooke & Jeeves optimisation algorithm\n");
+  if (EcoSystem->getNumForks() > 0)
+    handle.logMessage(LOGINFO, "Evaluating the steps for each parameter using", max(threads, EcoSystem->getNumForks()), "worker processes");
+  else if (threads > 1)
+    handle.logMessage(LOGINFO, "Evaluating the steps for each parameter using", threads, "threads");
   int nvars = EcoSystem->numOptVariables();
   DoubleVector x(nvars);
   DoubleVector trialx(nvars);
@@ -324,7 +409,7 @@ void OptInfoHooke::OptimiseLikelihood() {
 
       /* only move forward if this is really an improvement    */
       oldf = newf;
-      newf = EcoSystem->SimulateAndUpdate(trialx);
+      newf = EcoSystem->SimulateAndUpdate(trialx, oldf);
       if ((isEqual(newf, oldf)) || (newf > oldf)) {
         newf = oldf;  //JMB no improvement, so reset the value of newf
         break;
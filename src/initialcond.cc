@@ -83,9 +83,11 @@ void InitialCond::readNormalConditionData(CommentStream& infile, Keeper* const k
   handle.logMessage(LOGMESSAGE, "Read initial conditions data file - number of entries", count);
   areaFactor.Inform(keeper);
   ageFactor.Inform(keeper);
+  keeper->setDependency(&parchanged);
   meanLength.Inform(keeper);
   sdevLength.Inform(keeper);
   relCond.Inform(keeper);
+  keeper->clearDependency();
   keeper->clearLast();
 }
 
@@ -168,10 +170,12 @@ void InitialCond::readNormalParameterData(CommentStream& infile, Keeper* const k
   handle.logMessage(LOGMESSAGE, "Read initial conditions data file - number of entries", count);
   areaFactor.Inform(keeper);
   ageFactor.Inform(keeper);
+  keeper->setDependency(&parchanged);
   meanLength.Inform(keeper);
   sdevLength.Inform(keeper);
   alpha.Inform(keeper);
   beta.Inform(keeper);
+  keeper->clearDependency();
   keeper->clearLast();
 }
 
@@ -257,8 +261,10 @@ void InitialCond::readNumberData(CommentStream& infile, Keeper* const keeper,
     }
   }
 
+  keeper->setDependency(&parchanged);
   for (i = 0; i < initialNumber.Size(); i++)
     (*initialNumber[i]).Inform(keeper);
+  keeper->clearDependency();
 
   if (count == 0)
     handle.logMessage(LOGWARN, "Warning in initial conditions - found no data in the data file");
@@ -289,6 +295,7 @@ InitialCond::InitialCond(CommentStream& infile, const IntVector& Areas,
   char c;
   double minlength, maxlength, dl;
 
+  parchanged = 1;
   keeper->addString("initialcond");
 
   infile >> ws;
@@ -323,7 +330,9 @@ InitialCond::InitialCond(CommentStream& infile, const IntVector& Areas,
     readWordAndVariable(infile, "sdev", sdevMult);
   else
     sdevMult.setValue(1.0);
+  keeper->setDependency(&parchanged);
   sdevMult.Inform(keeper);
+  keeper->clearDependency();
   keeper->clearLast();
 
   //create the initialPop object of the correct size
@@ -459,13 +468,36 @@ void InitialCond::Print(ofstream& outfile) const {
   outfile.flush();
 }
 
+double InitialCond::calcNormalDistribution(PopInfoIndexVector& pop, double mean, double mult) {
+  int l, minl = pop.minCol(), numlen = pop.Size();
+  double dnorm, sum = 0.0;
+
+  if (numlen <= 0)
+    return 0.0;
+  if (normdist.Size() < numlen)
+    normdist.resize(numlen - normdist.Size(), 0.0);
+  for (l = 0; l < numlen; l++) {
+    dnorm = (LgrpDiv->meanLength(l + minl) - mean) * mult;
+    normdist[l] = -(dnorm * dnorm) * 0.5;
+  }
+  calcExpVector(&normdist[0], &normdist[0], numlen);
+  for (l = 0; l < numlen; l++) {
+    pop[l + minl].N = normdist[l];
+    sum += normdist[l];
+  }
+  return sum;
+}
+
 void InitialCond::Initialise(AgeBandMatrixPtrVector& Alkeys) {
 
   int area, age, l;
   int minage, maxage;
-  double mult, scaler, dnorm;
+  double mult, scaler;
 
-  if (readoption == 0) {
+  if (!parchanged) {
+    // nothing to do - the initial population from the last model run can be used since the parameters havent changed
+
+  } else if (readoption == 0) {
     if (isZero(sdevMult))  //JMB this should never happen ...
       handle.logMessage(LOGFAIL, "Error in initial conditions - multiplier for standard deviation is zero");
 
@@ -491,13 +523,8 @@ void InitialCond::Initialise(AgeBandMatrixPtrVector& Alkeys) {
           if (meanLength[area][age - minage] > LgrpDiv->maxLength())
             handle.logMessage(LOGWARN, "Warning in initial conditions - mean length is greater than maximum length for stock", this->getName());
 
-          scaler = 0.0;
           mult = 1.0 / (sdevLength[area][age - minage] * sdevMult);
-          for (l = initialPop[area].minLength(age); l < initialPop[area].maxLength(age); l++) {
-            dnorm = (LgrpDiv->meanLength(l) - meanLength[area][age - minage]) * mult;
-            initialPop[area][age][l].N = exp(-(dnorm * dnorm) * 0.5);
-            scaler += initialPop[area][age][l].N;
-          }
+          scaler = this->calcNormalDistribution(initialPop[area][age], meanLength[area][age - minage], mult);
 
           if (isZero(scaler)) {
             handle.logMessage(LOGWARN, "Warning in initial population - calculated zero population");
@@ -542,13 +569,8 @@ void InitialCond::Initialise(AgeBandMatrixPtrVector& Alkeys) {
           if (meanLength[area][age - minage] > LgrpDiv->maxLength())
             handle.logMessage(LOGWARN, "Warning in initial conditions - mean length is greater than maximum length for stock", this->getName());
 
-          scaler = 0.0;
           mult = 1.0 / (sdevLength[area][age - minage] * sdevMult);
-          for (l = initialPop[area].minLength(age); l < initialPop[area].maxLength(age); l++) {
-            dnorm = (LgrpDiv->meanLength(l) - meanLength[area][age - minage]) * mult;
-            initialPop[area][age][l].N = exp(-(dnorm * dnorm) * 0.5);
-            scaler += initialPop[area][age][l].N;
-          }
+          scaler = this->calcNormalDistribution(initialPop[area][age], meanLength[area][age - minage], mult);
 
           if (isZero(scaler)) {
             handle.logMessage(LOGWARN, "Warning in initial population - calculated zero population for stock", this->getName());
@@ -588,6 +610,7 @@ void InitialCond::Initialise(AgeBandMatrixPtrVector& Alkeys) {
   } else
     handle.logMessage(LOGFAIL, "Error in initial conditions - unrecognised data format");
 
+  parchanged = 0;
   mult = 1.0;
   for (area = 0; area < areas.Size(); area++) {
     Alkeys[area].setToZero();
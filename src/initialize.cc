@@ -112,8 +112,18 @@ void Ecosystem::Initialise() {
   for (i = 0; i < fleetvec.Size(); i++)
     basevec.resize(fleetvec[i]);
 
+  //The predation on each area can be calculated at the same time unless information is shared between the areas
+  areaconcurrent = ((Area->numAreas() > 1) && (tagvec.Size() == 0));
+  for (i = 0; i < fleetvec.Size(); i++)
+    if (fleetvec[i]->getType() == QUOTAFLEET)
+      areaconcurrent = 0;
+
+  //The stocks that dont move fish between each other can be updated at the same time
+  this->setStockGroups();
+
   //Next we initialise the likelihood classes
   count = 0;  //JMB count the number of understocking classes
+  likeconcurrent = 1;
   for (i = 0; i < likevec.Size(); i++) {
     handle.logMessage(LOGMESSAGE, "Initialising likelihood component", likevec[i]->getName());
     switch (likevec[i]->getType()) {
@@ -158,6 +168,7 @@ void Ecosystem::Initialise() {
         break;
       case PROGLIKELIHOOD:
         ((ProgLikelihood*)likevec[i])->setFleetsAndStocks(fleetvec, stockvec);
+        likeconcurrent = 0;
         break;
       default:
         handle.logMessage(LOGFAIL, "Error when initialising model - unrecognised likelihood type", likevec[i]->getType());
@@ -212,4 +223,106 @@ void Ecosystem::Initialise() {
         break;
     }
   }
+
+  //Set up the list of the parts of the model simulation that are timed
+  if ((profile.isActive()) && (profile.numEntries() == 0))
+    this->initialiseProfile();
+
+  //Then we initialise any worker copies of the model with the current values
+  if (workers.Size() > 0) {
+    for (i = 0; i < workers.Size(); i++) {
+      workers[i]->keeper->Update(keeper);
+      ErrorHandler::setActive(workers[i]->errorhandler);
+      workers[i]->Initialise();
+      ErrorHandler::setActive(0);
+    }
+  }
+
+  //Finally start the worker processes, which are copies of the initialised model
+  if ((numforks > 0) && (farmfd.Size() == 0))
+    this->startFarm();
+}
+
+void Ecosystem::setStockGroups() {
+  int i;
+  IntVector group(stockvec.Size(), 0);
+  IntVector row(stockvec.Size(), -1);
+  StockPtrVector tagged;
+
+  //each stock starts in a group on its own, and then the groups of linked stocks are joined
+  for (i = 0; i < stockvec.Size(); i++)
+    group[i] = i;
+  for (i = 0; i < stockvec.Size(); i++) {
+    if (stockvec[i]->doesMature())
+      this->joinStockGroups(group, i, stockvec[i]->getMatureStocks());
+    if (stockvec[i]->doesMove())
+      this->joinStockGroups(group, i, stockvec[i]->getTransitionStocks());
+    if (stockvec[i]->doesSpawn())
+      this->joinStockGroups(group, i, stockvec[i]->getSpawnStocks());
+    if (stockvec[i]->doesStray())
+      this->joinStockGroups(group, i, stockvec[i]->getStrayStocks());
+  }
+
+  //the tagging experiments are shared between all the tagged stocks
+  for (i = 0; i < stockvec.Size(); i++)
+    if (stockvec[i]->isTagged())
+      tagged.resize(stockvec[i]);
+  for (i = 0; i < stockvec.Size(); i++)
+    if (stockvec[i]->isTagged())
+      this->joinStockGroups(group, i, tagged);
+
+  //the stocks are kept in the same order within each group
+  stockgroups.Reset();
+  for (i = 0; i < stockvec.Size(); i++) {
+    if (row[group[i]] < 0) {
+      row[group[i]] = stockgroups.Nrow();
+      stockgroups.AddRows(1, 0, 0);
+    }
+    stockgroups[row[group[i]]].resize(1, i);
+  }
+  handle.logMessage(LOGMESSAGE, "Number of groups of stocks that can be updated at the same time", stockgroups.Nrow());
+}
+
+void Ecosystem::joinStockGroups(IntVector& group, int stock, const StockPtrVector& linked) {
+  int i, j, k, oldgroup;
+  for (i = 0; i < linked.Size(); i++)
+    for (j = 0; j < stockvec.Size(); j++)
+      if ((stockvec[j] == linked[i]) && (group[j] != group[stock])) {
+        oldgroup = group[j];
+        for (k = 0; k < stockvec.Size(); k++)
+          if (group[k] == oldgroup)
+            group[k] = group[stock];
+      }
+}
+
+void Ecosystem::initialiseProfile() {
+  int i;
+  char text[MaxStrLength];
+  strncpy(text, "", MaxStrLength);
+
+  //these entries must be in the same order as the ProfilePhase list
+  profile.addEntry("phase", "simulate");
+  profile.addEntry("phase", "reset");
+  profile.addEntry("phase", "print");
+  profile.addEntry("phase", "migration");
+  profile.addEntry("phase", "population");
+  profile.addEntry("phase", "likelihood");
+  profile.addEntry("phase", "age");
+  for (i = 0; i < TimeInfo->maxSubSteps(); i++) {
+    sprintf(text, "predation%d", i + 1);
+    profile.addEntry("phase", text);
+  }
+
+  //basevec contains the stocks, then the otherfood and then the fleets
+  profbase = profile.numEntries();
+  for (i = 0; i < stockvec.Size(); i++)
+    profile.addEntry("stock", stockvec[i]->getName());
+  for (i = 0; i < otherfoodvec.Size(); i++)
+    profile.addEntry("otherfood", otherfoodvec[i]->getName());
+  for (i = 0; i < fleetvec.Size(); i++)
+    profile.addEntry("fleet", fleetvec[i]->getName());
+
+  proflike = profile.numEntries();
+  for (i = 0; i < likevec.Size(); i++)
+    profile.addEntry("likelihood", likevec[i]->getName());
 }
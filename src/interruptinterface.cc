@@ -3,8 +3,6 @@
 #include "ecosystem.h"
 #include "gadget.h"
 
-extern Ecosystem* EcoSystem;
-
 void InterruptInterface::printMenu() {
   if (EcoSystem->getFuncEval() != 0)
     cout << "\nInterrupted after " << EcoSystem->getFuncEval() << " iterations ...";
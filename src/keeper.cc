@@ -1,18 +1,19 @@
 #include "keeper.h"
 #include "errorhandler.h"
 #include "runid.h"
-#include "ecosystem.h"
+#include "optinfo.h"
 #include "gadget.h"
 #include "global.h"
 
-extern Ecosystem* EcoSystem;
-
 Keeper::Keeper() {
   stack = new StrStack();
   boundsgiven = 0;
   fileopen = 0;
+  modelstocks = 0;
   numoptvar = 0;
   bestlikelihood = 0.0;
+  tracestep = 0;
+  tracing = 0;
 }
 
 void Keeper::keepVariable(double& value, Parameter& attr) {
@@ -38,6 +39,7 @@ void Keeper::keepVariable(double& value, Parameter& attr) {
     address[index][0] = &value;
     if (stack->getSize() != 0)
       address[index][0] = stack->sendAll();
+    dependency.push_back(vector<int*>());
 
   } else {
     if (value != values[index]) {
@@ -51,6 +53,16 @@ void Keeper::keepVariable(double& value, Parameter& attr) {
         address[index][i] = stack->sendAll();
     }
   }
+
+  //let the model components that are being read know that they use this switch
+  unsigned int j, k;
+  for (j = 0; j < depstack.size(); j++) {
+    for (k = 0; k < dependency[index].size(); k++)
+      if (dependency[index][k] == depstack[j])
+        break;
+    if (k == dependency[index].size())
+      dependency[index].push_back(depstack[j]);
+  }
 }
 
 Keeper::~Keeper() {
@@ -73,6 +85,7 @@ void Keeper::deleteParameter(const double& var) {
         if (address[i].Size() == 0) {
           //the variable we deleted was the only one with this switch
           address.Delete(i);
+          dependency.erase(dependency.begin() + i);
           switches.Delete(i);
           values.Delete(i);
           bestvalues.Delete(i);
@@ -105,6 +118,47 @@ void Keeper::changeVariable(const double& pre, double& post) {
     handle.logMessage(LOGFAIL, "Error in keeper - failed to change variables");
 }
 
+void Keeper::setDependency(int* const flag) {
+  depstack.push_back(flag);
+}
+
+void Keeper::clearDependency() {
+  if (depstack.size() == 0)
+    handle.logMessage(LOGFAIL, "Error in keeper - no model component to stop recording parameters for");
+  depstack.pop_back();
+}
+
+int Keeper::getNaNFlag() const {
+  unsigned int i;
+  for (i = 0; i < nanflags.size(); i++)
+    if (*nanflags[i])
+      return 1;
+  return 0;
+}
+
+void Keeper::clearNaNFlags() const {
+  unsigned int i;
+  for (i = 0; i < nanflags.size(); i++)
+    *nanflags[i] = 0;
+}
+
+void Keeper::writeVariable(int i, double value) {
+  int j, check;
+  unsigned int k;
+  check = 0;
+  for (j = 0; j < address.Ncol(i); j++) {
+    if (*address[i][j].addr != value) {  //any change to the value must be used, however small
+      *address[i][j].addr = value;
+      check = 1;
+    }
+  }
+
+  //let the model components that use this switch know that it has changed
+  if (check)
+    for (k = 0; k < dependency[i].size(); k++)
+      *dependency[i][k] = 1;
+}
+
 void Keeper::clearLast() {
   stack->clearString();
 }
@@ -200,14 +254,12 @@ void Keeper::scaleVariables() {
 }
 
 void Keeper::Update(const DoubleVector& val) {
-  int i, j;
+  int i;
   if (val.Size() != values.Size())
     handle.logMessage(LOGFAIL, "Error in keeper - received wrong number of variables to update");
 
   for (i = 0; i < address.Nrow(); i++) {
-    for (j = 0; j < address.Ncol(i); j++)
-      *address[i][j].addr = val[i];
-
+    this->writeVariable(i, val[i]);
     values[i] = val[i];
     if (isZero(initialvalues[i])) {
       if (opt[i])
@@ -219,14 +271,30 @@ void Keeper::Update(const DoubleVector& val) {
   }
 }
 
-void Keeper::Update(int pos, double& value) {
+void Keeper::Update(const Keeper* const keeper) {
   int i;
+  if (keeper->values.Size() != values.Size())
+    handle.logMessage(LOGFAIL, "Error in keeper - received wrong number of variables to update");
+
+  values = keeper->values;
+  bestvalues = keeper->bestvalues;
+  initialvalues = keeper->initialvalues;
+  scaledvalues = keeper->scaledvalues;
+  lowerbds = keeper->lowerbds;
+  upperbds = keeper->upperbds;
+  opt = keeper->opt;
+  numoptvar = keeper->numoptvar;
+  boundsgiven = keeper->boundsgiven;
+  bestlikelihood = keeper->bestlikelihood;
+  for (i = 0; i < address.Nrow(); i++)
+    this->writeVariable(i, values[i]);
+}
+
+void Keeper::Update(int pos, double& value) {
   if (pos <= 0 && pos >= address.Nrow())
     handle.logMessage(LOGFAIL, "Error in keeper - received invalid variable to update");
 
-  for (i = 0; i < address.Ncol(pos); i++)
-    *address[pos][i].addr = value;
-
+  this->writeVariable(pos, value);
   values[pos] = value;
   if (isZero(initialvalues[pos])) {
     if (opt[pos])
@@ -280,32 +348,42 @@ void Keeper::writeInitialInformation(const LikelihoodPtrVector& likevec) {
   outfile << ";\n; Listing of the output from the likelihood components for the current Gadget run\n;\n";
 }
 
-void Keeper::writeValues(const LikelihoodPtrVector& likevec, int prec) {
+void Keeper::writeValues(const LikelihoodPtrVector& likevec, int funceval, double likelihood, int prec) {
+  int i;
+  DoubleVector likevalues(likevec.Size(), 0.0);
+  for (i = 0; i < likevec.Size(); i++)
+    likevalues[i] = likevec[i]->getUnweightedLikelihood();
+  this->writeValues(values, likevalues, funceval, likelihood, prec);
+}
+
+void Keeper::writeValues(const DoubleVector& val, const DoubleVector& likevalues,
+  int funceval, double likelihood, int prec) {
+
   if (!fileopen)
     handle.logMessage(LOGFAIL, "Error in keeper - cannot write to output file");
 
   //JMB - print the number of function evaluations at the start of the line
-  outfile << EcoSystem->getFuncEval() << TAB;
+  outfile << funceval << TAB;
 
   int i, p, w;
   p = prec;
   if (prec == 0)
     p = printprecision;
   w = p + 4;
-  for (i = 0; i < values.Size(); i++)
-    outfile << setw(w) << setprecision(p) << values[i] << sep;
+  for (i = 0; i < val.Size(); i++)
+    outfile << setw(w) << setprecision(p) << val[i] << sep;
 
   if (prec == 0)
     p = smallprecision;
   w = p + 4;
   outfile << TAB << TAB;
-  for (i = 0; i < likevec.Size(); i++)
-    outfile << setw(w) << setprecision(p) << likevec[i]->getUnweightedLikelihood() << sep;
+  for (i = 0; i < likevalues.Size(); i++)
+    outfile << setw(w) << setprecision(p) << likevalues[i] << sep;
 
   if (prec == 0)
     p = fullprecision;
   w = p + 4;
-  outfile << TAB << TAB << setw(w) << setprecision(p) << EcoSystem->getLikelihood() << endl;
+  outfile << TAB << TAB << setw(w) << setprecision(p) << likelihood << endl;
 }
 
 void Keeper::Update(const StochasticData* const Stoch) {
@@ -379,8 +457,7 @@ void Keeper::Update(const StochasticData* const Stoch) {
   }
 
   for (i = 0; i < address.Nrow(); i++)
-    for (j = 0; j < address.Ncol(i); j++)
-      *address[i][j].addr = values[i];
+    this->writeVariable(i, values[i]);
 }
 
 void Keeper::getOptFlags(IntVector& optimise) const {
@@ -395,7 +472,8 @@ void Keeper::getSwitches(ParameterVector& sw) const {
     sw[i] = switches[i];
 }
 
-void Keeper::writeParams(const OptInfoPtrVector& optvec, const char* const filename, int prec, int interrupt) {
+void Keeper::writeParams(const OptInfoPtrVector& optvec, const char* const filename,
+  int funceval, double likelihood, int prec, int interrupt) {
 
   int i, p, w, check;
   ofstream paramfile;
@@ -412,13 +490,13 @@ void Keeper::writeParams(const OptInfoPtrVector& optvec, const char* const filen
   RUNID.Print(paramfile);
 
   if (interrupt) {
-    paramfile << "; Gadget was interrupted after " << EcoSystem->getFuncEval()
+    paramfile << "; Gadget was interrupted after " << funceval
       << " function evaluations\n; the best likelihood value found so far is "
       << setprecision(p) << bestlikelihood << endl;
 
-  } else if (EcoSystem->getFuncEval() == 0) {
+  } else if (funceval == 0) {
     paramfile << "; a simulation run was performed giving a likelihood value of "
-      << setprecision(p) << EcoSystem->getLikelihood() << endl;
+      << setprecision(p) << likelihood << endl;
 
   } else {
     for (i = 0; i < optvec.Size(); i++)
@@ -531,3 +609,64 @@ void Keeper::storeVariables(double likvalue, const DoubleVector& point) {
     }
   }
 }
+
+void Keeper::startTrace() {
+  int i, j, k, tmpsw;
+  unsigned int d;
+  const double* tmpaddr;
+
+  //every model component needs to use the parameters for the run to be recorded
+  for (i = 0; i < address.Nrow(); i++)
+    for (d = 0; d < dependency[i].size(); d++)
+      *dependency[i][d] = 1;
+
+  tracestep = 0;
+  tracing = 1;
+#ifdef GADGET_THREADS
+  tracethread = pthread_self();
+#endif
+  if (firstuse.Size() == 0) {
+    //the addresses dont change once the model has been read, so only sort these once
+    firstuse.resize(address.Nrow(), -1);
+    for (i = 0; i < address.Nrow(); i++) {
+      for (j = 0; j < address.Ncol(i); j++) {
+        k = traceswitch.Size();
+        traceaddr.push_back(address[i][j].addr);
+        traceswitch.resize(1, i);
+        while ((k > 0) && (traceaddr[k] < traceaddr[k - 1])) {
+          tmpaddr = traceaddr[k];
+          traceaddr[k] = traceaddr[k - 1];
+          traceaddr[k - 1] = tmpaddr;
+          tmpsw = traceswitch[k];
+          traceswitch[k] = traceswitch[k - 1];
+          traceswitch[k - 1] = tmpsw;
+          k--;
+        }
+      }
+    }
+  }
+}
+
+void Keeper::traceVariable(const double* const var) {
+  int low, high, mid, sw;
+  low = 0;
+  high = traceswitch.Size() - 1;
+  while (low <= high) {
+    mid = (low + high) / 2;
+    if (traceaddr[mid] == var) {
+      sw = traceswitch[mid];
+      if ((firstuse[sw] < 0) || (tracestep < firstuse[sw]))
+        firstuse[sw] = tracestep;
+      return;
+    } else if (traceaddr[mid] < var)
+      low = mid + 1;
+    else
+      high = mid - 1;
+  }
+}
+
+int Keeper::getFirstUse(int i) const {
+  if ((i < 0) || (i >= firstuse.Size()) || (firstuse[i] < 0))
+    return 0;
+  return firstuse[i];
+}
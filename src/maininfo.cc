@@ -18,6 +18,8 @@ void MainInfo::showUsage() {
     << " -l                           perform a likelihood (optimising) model run\n"
     << " -s                           perform a single (simulation) model run\n"
     << " -n                           perform a network run (using paramin)\n"
+    << " -socket <filename>           perform a network run, accepting requests\n"
+    << "                              from a local socket called <filename>\n"
     << " -v --version                 display version information and exit\n"
     << " -h --help                    display this help screen and exit\n"
     << "\nOptions for specifying the input to Gadget models:\n"
@@ -32,18 +34,29 @@ void MainInfo::showUsage() {
     << " -o <filename>                print likelihood output to <filename>\n"
     << " -print <number>              print -o output every <number> iterations\n"
     << " -precision <number>          set the precision to <number> in output files\n"
+    << " -forks <number>              use <number> worker processes to run the model\n"
+    << " -threads <number>            use <number> threads to run the model\n"
+    << " -simthreads <number>         use <number> threads within each simulation\n"
+    << " -fastmath                    use faster approximations to the math functions\n"
+    << " -checkpoints <number>        keep <number> snapshots of the model to\n"
+    << "                              resume the simulation from when optimising\n"
+    << " -evalcache <number>          store the likelihood scores for <number> points\n"
+    << "                              that have been evaluated when optimising\n"
     << "\nOptions for debugging Gadget models:\n"
     << " -log <filename>              print logging information to <filename>\n"
     << " -printinitial <filename>     print initial model information to <filename>\n"
     << " -printfinal <filename>       print final model information to <filename>\n"
+    << " -profile <filename>          print the time spent in each part of the model\n"
+    << "                              simulation to <filename>\n"
     << "\nFor more information see the Gadget web page at http://www.hafro.is/gadget\n\n";
   exit(EXIT_SUCCESS);
 }
 
 MainInfo::MainInfo()
   : givenOptInfo(0), givenInitialParam(0), runoptimise(0),
-    runstochastic(0), runnetwork(0), runprint(1), forceprint(0),
-    printInitialInfo(0), printFinalInfo(0), printLogLevel(0), maxratio(0.95) {
+    runstochastic(0), runnetwork(0), runprint(1), forceprint(0), fastmath(0),
+    printInitialInfo(0), printFinalInfo(0), printLogLevel(0), maxratio(0.95),
+    numforks(0), numthreads(1), numsimthreads(1), numcheckpoints(0), evalcachesize(EVALCACHESIZE), givenSocket(0), givenProfile(0) {
 
   char tmpname[10];
   strncpy(tmpname, "", 10);
@@ -54,6 +67,8 @@ MainInfo::MainInfo()
   strPrintInitialFile = NULL;
   strPrintFinalFile = NULL;
   strMainGadgetFile = NULL;
+  strSocketFile = NULL;
+  strProfileFile = NULL;
   setMainGadgetFile(tmpname);
 }
 
@@ -78,6 +93,14 @@ MainInfo::~MainInfo() {
     delete[] strMainGadgetFile;
     strMainGadgetFile = NULL;
   }
+  if (strSocketFile != NULL) {
+    delete[] strSocketFile;
+    strSocketFile = NULL;
+  }
+  if (strProfileFile != NULL) {
+    delete[] strProfileFile;
+    strProfileFile = NULL;
+  }
 }
 
 void MainInfo::read(int aNumber, char* const aVector[]) {
@@ -95,9 +118,41 @@ void MainInfo::read(int aNumber, char* const aVector[]) {
     } else if (strcasecmp(aVector[k], "-n") == 0) {
       runnetwork = 1;
 
-#ifndef GADGET_NETWORK
-      handle.logMessage(LOGFAIL, "Error - Gadget cannot currently run in network mode for paramin\nGadget must be recompiled to enable the network communication");
-#endif
+    } else if (strcasecmp(aVector[k], "-socket") == 0) {
+      if (k == aNumber - 1)
+        this->showCorrectUsage(aVector[k]);
+      k++;
+      this->setSocketFile(aVector[k]);
+
+    } else if (strcasecmp(aVector[k], "-forks") == 0) {
+      if (k == aNumber - 1)
+        this->showCorrectUsage(aVector[k]);
+      k++;
+      numforks = atoi(aVector[k]);
+
+    } else if (strcasecmp(aVector[k], "-threads") == 0) {
+      if (k == aNumber - 1)
+        this->showCorrectUsage(aVector[k]);
+      k++;
+      numthreads = atoi(aVector[k]);
+
+    } else if (strcasecmp(aVector[k], "-simthreads") == 0) {
+      if (k == aNumber - 1)
+        this->showCorrectUsage(aVector[k]);
+      k++;
+      numsimthreads = atoi(aVector[k]);
+
+    } else if (strcasecmp(aVector[k], "-checkpoints") == 0) {
+      if (k == aNumber - 1)
+        this->showCorrectUsage(aVector[k]);
+      k++;
+      numcheckpoints = atoi(aVector[k]);
+
+    } else if (strcasecmp(aVector[k], "-evalcache") == 0) {
+      if (k == aNumber - 1)
+        this->showCorrectUsage(aVector[k]);
+      k++;
+      evalcachesize = atoi(aVector[k]);
 
     } else if (strcasecmp(aVector[k], "-s") == 0) {
       runstochastic = 1;
@@ -137,6 +192,9 @@ void MainInfo::read(int aNumber, char* const aVector[]) {
     } else if (strcasecmp(aVector[k], "-forceprint") == 0) {
       forceprint = 1;
 
+    } else if (strcasecmp(aVector[k], "-fastmath") == 0) {
+      fastmath = 1;
+
     } else if (strcasecmp(aVector[k], "-co") == 0) {
       handle.logMessage(LOGFAIL, "The -co switch is no longer supported");
 
@@ -152,6 +210,12 @@ void MainInfo::read(int aNumber, char* const aVector[]) {
       k++;
       this->setPrintFinalFile(aVector[k]);
 
+    } else if (strcasecmp(aVector[k], "-profile") == 0) {
+      if (k == aNumber - 1)
+        this->showCorrectUsage(aVector[k]);
+      k++;
+      this->setProfileFile(aVector[k]);
+
     } else if (strcasecmp(aVector[k], "-main") == 0) {
       if (k == aNumber - 1)
         this->showCorrectUsage(aVector[k]);
@@ -303,6 +367,12 @@ void MainInfo::checkUsage(const char* const inputdir, const char* const workingd
     tmpout.close();
     tmpout.clear();
   }
+  if (givenProfile) {
+    tmpout.open(strProfileFile, ios::out);
+    handle.checkIfFailure(tmpout, strProfileFile);
+    tmpout.close();
+    tmpout.clear();
+  }
   printinfo.checkPrintInfo(runnetwork);
 
   //JMB check the value of maxratio
@@ -311,6 +381,57 @@ void MainInfo::checkUsage(const char* const inputdir, const char* const workingd
     maxratio = 0.95;
   }
 
+#ifndef GADGET_NETWORK
+  if ((runnetwork) && (!givenSocket))
+    handle.logMessage(LOGFAIL, "Error - Gadget cannot currently run in network mode for paramin\nGadget must be recompiled to enable the network communication, or started with the -socket option");
+#endif
+#ifndef NOT_WINDOWS
+  if (givenSocket)
+    handle.logMessage(LOGFAIL, "Error - Gadget cannot serve a network run on a socket on this platform");
+  if (numforks > 0) {
+    handle.logMessage(LOGWARN, "Warning - Gadget cannot use worker processes on this platform");
+    numforks = 0;
+  }
+  if (numcheckpoints > 0) {
+    handle.logMessage(LOGWARN, "Warning - Gadget cannot keep snapshots of the model on this platform");
+    numcheckpoints = 0;
+  }
+#endif
+
+  if (numforks < 0) {
+    handle.logMessage(LOGWARN, "Warning - number of worker processes less than zero", numforks);
+    numforks = 0;
+  }
+  if (numthreads < 1) {
+    handle.logMessage(LOGWARN, "Warning - number of threads less than one", numthreads);
+    numthreads = 1;
+  }
+  if (numsimthreads < 1) {
+    handle.logMessage(LOGWARN, "Warning - number of simulation threads less than one", numsimthreads);
+    numsimthreads = 1;
+  }
+  if (numcheckpoints < 0) {
+    handle.logMessage(LOGWARN, "Warning - number of snapshots less than zero", numcheckpoints);
+    numcheckpoints = 0;
+  }
+  if (numcheckpoints > MAXCHECKPOINTS) {
+    //each snapshot is a copy of the Gadget process, so the number is limited to keep the memory used reasonable
+    handle.logMessage(LOGWARN, "Warning - number of snapshots greater than the maximum", MAXCHECKPOINTS);
+    numcheckpoints = MAXCHECKPOINTS;
+  }
+  if (evalcachesize < 0) {
+    handle.logMessage(LOGWARN, "Warning - number of points in the evaluation cache less than zero", evalcachesize);
+    evalcachesize = 0;
+  }
+#ifndef GADGET_THREADS
+  if ((numthreads > 1) || (numsimthreads > 1))
+    handle.logMessage(LOGWARN, "Warning - Gadget was compiled without thread support, so the model will be evaluated serially");
+#endif
+  if ((numforks > 0) && (runnetwork)) {
+    handle.logMessage(LOGWARN, "Warning - Gadget cannot use worker processes for a network run");
+    numforks = 0;
+  }
+
   if ((!runstochastic) && (runnetwork)) {
     handle.logMessage(LOGWARN, "\nWarning - Gadget for the paramin network should be used with -s option\nGadget will now set the -s switch to perform a simulation run");
     runstochastic = 1;
@@ -380,11 +501,16 @@ void MainInfo::read(CommentStream& infile) {
     } else if (strcasecmp(text, "-printfinal") == 0) {
       infile >> text >> ws;
       this->setPrintFinalFile(text);
+    } else if (strcasecmp(text, "-profile") == 0) {
+      infile >> text >> ws;
+      this->setProfileFile(text);
     } else if (strcasecmp(text, "-opt") == 0) {
       infile >> text >> ws;
       this->setOptInfoFile(text);
     } else if (strcasecmp(text, "-forceprint") == 0) {
       forceprint = 1;
+    } else if (strcasecmp(text, "-fastmath") == 0) {
+      fastmath = 1;
     } else if (strcasecmp(text, "-noprint") == 0) {
       runprint = 0;
     } else if ((strcasecmp(text, "-print") == 0) || (strcasecmp(text, "-print1") == 0)) {
@@ -406,6 +532,19 @@ void MainInfo::read(CommentStream& infile) {
       srand(dummy);
     } else if (strcasecmp(text, "-maxratio") == 0) {
       infile >> maxratio >> ws;
+    } else if (strcasecmp(text, "-forks") == 0) {
+      infile >> numforks >> ws;
+    } else if (strcasecmp(text, "-threads") == 0) {
+      infile >> numthreads >> ws;
+    } else if (strcasecmp(text, "-simthreads") == 0) {
+      infile >> numsimthreads >> ws;
+    } else if (strcasecmp(text, "-checkpoints") == 0) {
+      infile >> numcheckpoints >> ws;
+    } else if (strcasecmp(text, "-evalcache") == 0) {
+      infile >> evalcachesize >> ws;
+    } else if (strcasecmp(text, "-socket") == 0) {
+      infile >> text >> ws;
+      this->setSocketFile(text);
     } else if (strcasecmp(text, "-printlikesummary") == 0) {
       handle.logMessage(LOGWARN, "The -printlikesummary switch is no longer supported\nSpecify a likelihoodsummaryprinter class in the model print file instead");
     } else if (strcasecmp(text, "-printlikelihood") == 0) {
@@ -465,3 +604,24 @@ void MainInfo::setOptInfoFile(char* filename) {
   strcpy(strOptInfoFile, filename);
   givenOptInfo = 1;
 }
+
+void MainInfo::setSocketFile(char* filename) {
+  if (strSocketFile != NULL) {
+    delete[] strSocketFile;
+    strSocketFile = NULL;
+  }
+  strSocketFile = new char[strlen(filename) + 1];
+  strcpy(strSocketFile, filename);
+  givenSocket = 1;
+  runnetwork = 1;
+}
+
+void MainInfo::setProfileFile(char* filename) {
+  if (strProfileFile != NULL) {
+    delete[] strProfileFile;
+    strProfileFile = NULL;
+  }
+  strProfileFile = new char[strlen(filename) + 1];
+  strcpy(strProfileFile, filename);
+  givenProfile = 1;
+}
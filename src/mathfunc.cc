@@ -0,0 +1,281 @@
+#include "mathfunc.h"
+#include "gadget.h"
+
+// ********************************************************
+// Functions for the vector versions of the math functions
+// ********************************************************
+//the mode is set once, before the model simulation starts
+static int mathmode = MATHEXACT;
+
+//the arrays are calculated in blocks, so that the results can be stored in the input array
+static const int blocksize = 64;
+
+//the number of values used to check the accuracy of each function
+static const int checksize = 2001;
+
+//the constants used in the fast approximations
+static const double log2e = 1.44269504088896338700e+00;
+static const double ln2hi = 6.93147180369123816490e-01;
+static const double ln2lo = 1.90821492927058770002e-10;
+static const unsigned long long sqrt2bits = 0x6a09e667f3bcdULL;  /* mantissa of sqrt(2) */
+static const double halflog2pi = 9.18938533204672669541e-01;
+static const double roundval = 6755399441055744.0;  /* 1.5 * 2^52 */
+static const double twoto52 = 4503599627370496.0;   /* 2^52 */
+static const double minnormal = 2.2250738585072014e-308;
+static const double maxnormal = 1.7976931348623157e+308;
+static const double minexp = -708.0;
+static const double maxexp = 709.0;
+static const double maxgamma = 1e+30;
+
+//these functions are written without branches so that the compiler can vectorise the loops
+//they are only valid for x in the range minexp to maxexp, or minnormal to maxnormal for the logarithm,
+//and the values outside this range are replaced by the values from the standard math library
+static inline double fastExp(double x) {
+  double n, r, p, scale;
+  unsigned long long bits;
+
+  //split x into n*log(2) + r, with |r| < 0.35, and use a polynomial for exp(r)
+  n = x * log2e + roundval;
+  memcpy(&bits, &n, sizeof(double));
+  n -= roundval;
+  r = (x - n * ln2hi) - n * ln2lo;
+  p = 1.0 / 6227020800.0;
+  p = p * r + 1.0 / 479001600.0;
+  p = p * r + 1.0 / 39916800.0;
+  p = p * r + 1.0 / 3628800.0;
+  p = p * r + 1.0 / 362880.0;
+  p = p * r + 1.0 / 40320.0;
+  p = p * r + 1.0 / 5040.0;
+  p = p * r + 1.0 / 720.0;
+  p = p * r + 1.0 / 120.0;
+  p = p * r + 1.0 / 24.0;
+  p = p * r + 1.0 / 6.0;
+  p = p * r + 0.5;
+  p = p * r + 1.0;
+  p = p * r + 1.0;
+
+  //the low bits of n + roundval hold the integer n, which gives the exponent of 2^n
+  bits = (bits + 1023ULL) << 52;
+  memcpy(&scale, &bits, sizeof(double));
+  return p * scale;
+}
+
+static inline double fastLog(double x) {
+  double m, e, s, z, p;
+  unsigned long long bits, ebits, mbits, adjust;
+
+  //split x into m*2^e, with m in the range sqrt(0.5) to sqrt(2)
+  memcpy(&bits, &x, sizeof(double));
+  mbits = bits & 0x000fffffffffffffULL;
+  adjust = (mbits + (0x000fffffffffffffULL - sqrt2bits)) >> 52;  /* 1 if m > sqrt(2) */
+  ebits = ((bits >> 52) + adjust) | 0x4330000000000000ULL;
+  memcpy(&e, &ebits, sizeof(double));
+  e -= (twoto52 + 1023.0);
+  mbits |= ((1023ULL - adjust) << 52);
+  memcpy(&m, &mbits, sizeof(double));
+
+  //log(m) = 2*atanh(s), with s = (m - 1) / (m + 1) and |s| < 0.172
+  s = (m - 1.0) / (m + 1.0);
+  z = s * s;
+  p = 1.0 / 23.0;
+  p = p * z + 1.0 / 21.0;
+  p = p * z + 1.0 / 19.0;
+  p = p * z + 1.0 / 17.0;
+  p = p * z + 1.0 / 15.0;
+  p = p * z + 1.0 / 13.0;
+  p = p * z + 1.0 / 11.0;
+  p = p * z + 1.0 / 9.0;
+  p = p * z + 1.0 / 7.0;
+  p = p * z + 1.0 / 5.0;
+  p = p * z + 1.0 / 3.0;
+  return e * ln2hi + (e * ln2lo + 2.0 * s + 2.0 * s * z * p);
+}
+
+//this is only valid for x in the range minnormal to maxgamma
+static inline double fastLogGamma(double x) {
+  int k;
+  double prod, rx, rx2, p;
+
+  //use the recursion lgamma(x) = lgamma(x + 1) - log(x) to get x >= 10
+  prod = 1.0;
+  for (k = 0; k < 10; k++) {
+    prod *= x;
+    x += 1.0;
+  }
+
+  //then use the Stirling series for lgamma(x)
+  rx = 1.0 / x;
+  rx2 = rx * rx;
+  p = 1.0 / 156.0;
+  p = p * rx2 - 691.0 / 360360.0;
+  p = p * rx2 + 1.0 / 1188.0;
+  p = p * rx2 - 1.0 / 1680.0;
+  p = p * rx2 + 1.0 / 1260.0;
+  p = p * rx2 - 1.0 / 360.0;
+  p = p * rx2 + 1.0 / 12.0;
+  return ((x - 0.5) * fastLog(x) - x + halflog2pi + p * rx) - fastLog(prod);
+}
+
+static inline int isExpRange(double x) {
+  return ((x >= minexp) && (x <= maxexp));
+}
+
+static inline int isLogRange(double x) {
+  return ((x >= minnormal) && (x <= maxnormal));
+}
+
+void setMathMode(int mode) {
+  mathmode = mode;
+}
+
+int getMathMode() {
+  return mathmode;
+}
+
+void calcExpVector(double* result, const double* x, int n) {
+  int i, j, num;
+  double tmp[blocksize];
+
+  if (mathmode != MATHFAST) {
+    for (i = 0; i < n; i++)
+      result[i] = exp(x[i]);
+    return;
+  }
+
+  for (i = 0; i < n; i += blocksize) {
+    num = min(blocksize, n - i);
+    for (j = 0; j < num; j++)
+      tmp[j] = fastExp(x[i + j]);
+    for (j = 0; j < num; j++)
+      if (!isExpRange(x[i + j]))
+        tmp[j] = exp(x[i + j]);
+    for (j = 0; j < num; j++)
+      result[i + j] = tmp[j];
+  }
+}
+
+void calcLogVector(double* result, const double* x, int n) {
+  int i, j, num;
+  double tmp[blocksize];
+
+  if (mathmode != MATHFAST) {
+    for (i = 0; i < n; i++)
+      result[i] = log(x[i]);
+    return;
+  }
+
+  for (i = 0; i < n; i += blocksize) {
+    num = min(blocksize, n - i);
+    for (j = 0; j < num; j++)
+      tmp[j] = fastLog(x[i + j]);
+    for (j = 0; j < num; j++)
+      if (!isLogRange(x[i + j]))
+        tmp[j] = log(x[i + j]);
+    for (j = 0; j < num; j++)
+      result[i + j] = tmp[j];
+  }
+}
+
+void calcPowVector(double* result, const double* x, double power, int n) {
+  int i, j, num;
+  double tmp[blocksize], logx[blocksize];
+
+  if (mathmode != MATHFAST) {
+    for (i = 0; i < n; i++)
+      result[i] = pow(x[i], power);
+    return;
+  }
+
+  //x^power is calculated as exp(power * log(x)) for positive x
+  for (i = 0; i < n; i += blocksize) {
+    num = min(blocksize, n - i);
+    for (j = 0; j < num; j++)
+      logx[j] = power * fastLog(x[i + j]);
+    for (j = 0; j < num; j++)
+      tmp[j] = fastExp(logx[j]);
+    for (j = 0; j < num; j++)
+      if ((!isLogRange(x[i + j])) || (!isExpRange(logx[j])))
+        tmp[j] = pow(x[i + j], power);
+    for (j = 0; j < num; j++)
+      result[i + j] = tmp[j];
+  }
+}
+
+void calcLogGammaVector(double* result, const double* x, int n) {
+  int i, j, num;
+  double tmp[blocksize];
+
+  if (mathmode != MATHFAST) {
+    for (i = 0; i < n; i++)
+      result[i] = lgamma(x[i]);
+    return;
+  }
+
+  for (i = 0; i < n; i += blocksize) {
+    num = min(blocksize, n - i);
+    for (j = 0; j < num; j++)
+      tmp[j] = fastLogGamma(x[i + j]);
+    for (j = 0; j < num; j++)
+      if (!((x[i + j] >= minnormal) && (x[i + j] <= maxgamma)))
+        tmp[j] = lgamma(x[i + j]);
+    for (j = 0; j < num; j++)
+      result[i + j] = tmp[j];
+  }
+}
+
+//the error is relative to the exact value, or absolute for values less than 1
+static inline double calcError(double value, double exact) {
+  return (fabs(value - exact) / max(fabs(exact), 1.0));
+}
+
+//check the fast approximation to one of the math functions against the standard math library
+static double checkVector(void (*func)(double*, const double*, int), const double* x, int n) {
+  int i;
+  double error = 0.0;
+  double fast[checksize], exact[checksize];
+
+  mathmode = MATHFAST;
+  (*func)(fast, x, n);
+  mathmode = MATHEXACT;
+  (*func)(exact, x, n);
+  for (i = 0; i < n; i++)
+    error = max(error, calcError(fast[i], exact[i]));
+  return error;
+}
+
+double checkMathAccuracy() {
+  int i, j, oldmode = mathmode;
+  double power, error = 0.0;
+  double x[checksize], fast[checksize], exact[checksize];
+
+  for (i = 0; i < checksize; i++)
+    x[i] = -700.0 + 0.7 * i;
+  error = max(error, checkVector(calcExpVector, x, checksize));
+  for (i = 0; i < checksize; i++)
+    x[i] = -1.0 + 0.001 * i;
+  error = max(error, checkVector(calcExpVector, x, checksize));
+  for (i = 0; i < checksize; i++)
+    x[i] = 0.001 * i;
+  error = max(error, checkVector(calcLogVector, x, checksize));
+  for (i = 0; i < checksize; i++)
+    x[i] = pow(10.0, -300.0 + 0.3 * i);
+  error = max(error, checkVector(calcLogVector, x, checksize));
+  for (i = 0; i < checksize; i++)
+    x[i] = 0.001 + 0.05 * i;
+  error = max(error, checkVector(calcLogGammaVector, x, checksize));
+
+  for (i = 0; i < checksize; i++)
+    x[i] = pow(10.0, -3.0 + 0.003 * i);
+  for (j = 0; j <= 20; j++) {
+    power = -3.0 + 0.3 * j;
+    mathmode = MATHFAST;
+    calcPowVector(fast, x, power, checksize);
+    mathmode = MATHEXACT;
+    calcPowVector(exact, x, power, checksize);
+    for (i = 0; i < checksize; i++)
+      error = max(error, calcError(fast[i], exact[i]));
+  }
+
+  mathmode = oldmode;
+  return error;
+}
@@ -17,6 +17,7 @@ Maturity::Maturity(const IntVector& tmpareas, int minage, int numage,
 
   int i;
   istagged = 0;
+  tablechanged = 1;
   tmpratio = 1.0;
   ratioscale = 1.0; //JMB used to scale the ratios to ensure that they sum to 1
   LgrpDiv = new LengthGroupDivision(*lgrpdiv);
@@ -36,6 +37,8 @@ Maturity::~Maturity() {
     delete[] matureStockNames[i];
   for (i = 0; i < CI.Size(); i++)
     delete CI[i];
+  for (i = 0; i < maturationTable.Size(); i++)
+    delete maturationTable[i];
   delete LgrpDiv;
 }
 
@@ -102,6 +105,7 @@ void Maturity::Reset(const TimeClass* const TimeInfo) {
   //JMB check that the sum of the ratios is 1
   if (TimeInfo->getTime() == 1) {
     int i;
+    tablechanged = 1;
     ratioscale = 0.0;
     for (i = 0; i < matureRatio.Size(); i++ )
       ratioscale += matureRatio[i];
@@ -146,6 +150,44 @@ void Maturity::storeMatureStock(int area, int age, int length, double number, do
   }
 }
 
+void Maturity::storeMatureStock(int area, int age, int minlength, int numlength,
+  const double* number, const double* weight) {
+
+  int i;
+  PopInfoIndexVector& store = Storage[this->areaNum(area)][age];
+  for (i = 0; i < numlength; i++) {
+    if (isZero(number[i]) || isZero(weight[i])) {
+      store[i + minlength].setToZero();
+    } else {
+      store[i + minlength].N = number[i];
+      store[i + minlength].W = weight[i];
+    }
+  }
+}
+
+const DoubleMatrix* Maturity::getMaturationTable(int age, int maxgrowth) {
+  if (this->isWeightDependent())
+    return 0;
+
+  int a, grow, len;
+  int minage = Storage[0].minAge();
+  if (maturationTable.Size() == 0) {
+    for (a = 0; a < Storage[0].Nrow(); a++)
+      maturationTable.resize(new DoubleMatrix(maxgrowth, LgrpDiv->numLengthGroups(), 0.0));
+    tablechanged = 1;
+  } else if (maturationTable[0]->Nrow() != maxgrowth)
+    handle.logMessage(LOGFAIL, "Error in maturity - received wrong number of length groups for growth");
+
+  if (tablechanged) {
+    for (a = 0; a < maturationTable.Size(); a++)
+      for (grow = 0; grow < maxgrowth; grow++)
+        for (len = 0; len < LgrpDiv->numLengthGroups(); len++)
+          (*maturationTable[a])[grow][len] = this->calcMaturation(a + minage, len, grow, 0.0);
+    tablechanged = 0;
+  }
+  return maturationTable[age - minage];
+}
+
 void Maturity::storeMatureTagStock(int area, int age, int length, double number, int id) {
   if (!istagged)
     handle.logMessage(LOGFAIL, "Error in maturity - invalid tagging experiment");
@@ -257,11 +299,14 @@ MaturityA::MaturityA(CommentStream& infile, const TimeClass* const TimeInfo,
 void MaturityA::Reset(const TimeClass* const TimeInfo) {
   Maturity::Reset(TimeInfo);
 
-  if (TimeInfo->didStepSizeChange())
+  if (TimeInfo->didStepSizeChange()) {
     timesteplength = TimeInfo->getTimeStepSize();
+    tablechanged = 1;
+  }
 
   maturityParameters.Update(TimeInfo);
   if (maturityParameters.didChange(TimeInfo)) {
+    tablechanged = 1;
     if (maturityParameters[1] < LgrpDiv->minLength())
       handle.logMessage(LOGWARN, "Warning in maturity calculation - l50 less than minimum length for stock", this->getName());
     if (maturityParameters[1] > LgrpDiv->maxLength())
@@ -408,6 +453,7 @@ void MaturityB::Reset(const TimeClass* const TimeInfo) {
   int i;
   maturitylength.Update(TimeInfo);
   if (maturitylength.didChange(TimeInfo)) {
+    tablechanged = 1;
     for (i = 0; i < maturitylength.Size(); i++) {
       if (maturitylength[i] < LgrpDiv->minLength())
         handle.logMessage(LOGWARN, "Warning in maturity calculation - length less than minimum stock length for stock", this->getName());
@@ -431,6 +477,8 @@ int MaturityB::isMaturationStep(const TimeClass* const TimeInfo) {
   int i;
   for (i = 0; i < maturitystep.Size(); i++) {
     if (maturitystep[i] == TimeInfo->getStep()) {
+      if (currentmaturitystep != i)
+        tablechanged = 1;
       currentmaturitystep = i;
       return 1;
     }
@@ -519,6 +567,7 @@ void MaturityC::Reset(const TimeClass* const TimeInfo) {
 
   maturityParameters.Update(TimeInfo);
   if (maturityParameters.didChange(TimeInfo)) {
+    tablechanged = 1;
     if (maturityParameters[1] < LgrpDiv->minLength())
       handle.logMessage(LOGWARN, "Warning in maturity calculation - l50 less than minimum length for stock", this->getName());
     if (maturityParameters[1] > LgrpDiv->maxLength())
@@ -26,6 +26,7 @@ MigrationNumbers::MigrationNumbers(CommentStream& infile, const IntVector& Areas
   : Migration(Areas, givenname) {
 
   int i, j;
+  parchanged = 1;
   ifstream subfile;
   CommentStream subcomment(subfile);
   char text[MaxStrLength];
@@ -227,10 +228,12 @@ void MigrationNumbers::readGivenRatios(CommentStream& infile, Keeper* const keep
   }
 
   // Inform keeper of the values and resize
+  keeper->setDependency(&parchanged);
   for (i = 0; i < readMigration.Size(); i++) {
     (*readMigration[i]).Inform(keeper);
     calcMigration.resize(new DoubleMatrix(numAreas, numAreas, 0.0));
   }
+  keeper->clearDependency();
 }
 
 void MigrationNumbers::readGivenMatrices(CommentStream& infile, Keeper* const keeper) {
@@ -291,10 +294,12 @@ void MigrationNumbers::readGivenMatrices(CommentStream& infile, Keeper* const ke
   }
 
   // Inform keeper of the values and resize
+  keeper->setDependency(&parchanged);
   for (i = 0; i < readMigration.Size(); i++) {
     (*readMigration[i]).Inform(keeper);
     calcMigration.resize(new DoubleMatrix(numAreas, numAreas, 0.0));
   }
+  keeper->clearDependency();
 }
 
 void MigrationNumbers::checkMatrixIndex() {
@@ -353,6 +358,11 @@ void MigrationNumbers::setMatrixName(char* name) {
 }
 
 void MigrationNumbers::Reset() {
+  //the matrices and penalty from the last model run can be used if the parameters havent changed
+  if (!parchanged)
+    return;
+  parchanged = 0;
+
   //JMB need to reset the penalty vector first
   penalty.Reset();
 
@@ -69,7 +69,7 @@ void ModelVariable::read(CommentStream& infile,
     } else if (strcasecmp(text, "stockdata") == 0) {
       // JMB this is a stockvariable
       mvtype = MVSTOCK;
-      SV.read(subcomment);
+      SV.read(subcomment, keeper);
 
     } else
       handle.logFileUnexpected(LOGFAIL, "timedata or stockdata", text);
@@ -63,6 +63,15 @@ int ModelVariableVector::didChange(const TimeClass* const TimeInfo) const {
   return 0;
 }
 
+int ModelVariableVector::usesStockData() const {
+  int i;
+  for (i = 0; i < size; i++)
+    if (v[i].getMVType() == MVSTOCK)
+      return 1;
+
+  return 0;
+}
+
 void ModelVariableVector::Update(const TimeClass* const TimeInfo) {
   int i;
   for (i = 0; i < size; i++)
@@ -4,37 +4,76 @@
 #include "gadget.h"
 #include "global.h"
 
+double Multinomial::calcDataTerm(const DoubleVector& data) {
+
+  int i, n = data.Size();
+  double sumdata, sumlog;
+  double* logvalue;
+
+  if (n == 0)
+    return 0.0;
+  if (scratch.Size() < n)
+    scratch.resize(n - scratch.Size(), 0.0);
+  logvalue = &scratch[0];
+
+  sumdata = sumlog = 0.0;
+  for (i = 0; i < n; i++) {
+    sumdata += data[i];
+    logvalue[i] = data[i] + 1.0;
+  }
+  calcLogGammaVector(logvalue, logvalue, n);
+  for (i = 0; i < n; i++)
+    sumlog += logvalue[i];
+
+  sumlog -= logFactorial(sumdata);
+  return sumlog;
+}
+
 double Multinomial::calcLogLikelihood(const DoubleVector& data, const DoubleVector& dist) {
+  return this->calcLogLikelihood(data, dist, this->calcDataTerm(data));
+}
 
-  int i;
+double Multinomial::calcLogLikelihood(const DoubleVector& data, const DoubleVector& dist, double dataterm) {
+
+  int i, n = data.Size();
   double minp = 1.0 / (dist.Size() * bigvalue);
-  double sumdist, sumdata, sumlog, likely, tmp;
+  double sumdist, likely, tmp;
+  double* logvalue;
 
   if (data.Size() != dist.Size())
     handle.logMessage(LOGFAIL, "Error in multinomial - vectors not the same size");
 
-  sumdist = sumdata = sumlog = likely = 0.0;
-  for (i = 0; i < data.Size(); i++) {
+  if (n == 0)
+    return 0.0;
+  if (scratch.Size() < n)
+    scratch.resize(n - scratch.Size(), 0.0);
+  logvalue = &scratch[0];
+
+  sumdist = likely = 0.0;
+  for (i = 0; i < n; i++)
     sumdist += dist[i];
-    sumdata += data[i];
-    sumlog += logFactorial(data[i]);
-  }
 
   if (isZero(sumdist))
     return 0.0;
 
   tmp = 1.0 / sumdist;
-  for (i = 0; i < data.Size(); i++) {
+  for (i = 0; i < n; i++) {
     if (isZero(data[i]))
-      likely += 0.0;
+      logvalue[i] = 1.0;
     else if (((dist[i] * tmp) > minp) || (isEqual((dist[i] * tmp), minp)))
-      likely -= data[i] * log(dist[i] * tmp);
+      logvalue[i] = dist[i] * tmp;
     else
-      likely -= data[i] * log(minp);
+      logvalue[i] = minp;
+  }
+  calcLogVector(logvalue, logvalue, n);
+  for (i = 0; i < n; i++) {
+    if (isZero(data[i]))
+      likely += 0.0;
+    else
+      likely -= data[i] * logvalue[i];
   }
 
-  sumlog -= logFactorial(sumdata);
-  tmp = 2.0 * (likely + sumlog);
+  tmp = 2.0 * (likely + dataterm);
   if (tmp < 0.0)
     handle.logMessage(LOGWARN, "Warning in multinomial - negative total", tmp);
 
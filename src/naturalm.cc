@@ -13,11 +13,14 @@ NaturalMortality::NaturalMortality(CommentStream& infile, int minage, int numage
 
   minStockAge = minage;
   readoption = 0;
+  parchanged = 1;
+  calctime = 0;
   proportion.AddRows(areas.Size(), numage, 0.0);
   keeper->addString("naturalmortality");
 
   infile >> ws;
   char c = infile.peek();
+  keeper->setDependency(&parchanged);
   if ((c == 'm') || (c == 'M')) {
     //JMB experimental mortality function
     readoption = 1;
@@ -39,6 +42,7 @@ NaturalMortality::NaturalMortality(CommentStream& infile, int minage, int numage
     mortality.read(infile, TimeInfo, keeper);
   }
 
+  keeper->clearDependency();
   keeper->clearLast();
 }
 
@@ -48,10 +52,19 @@ NaturalMortality::~NaturalMortality() {
 }
 
 void NaturalMortality::Reset(const TimeClass* const TimeInfo) {
+  //the values from the first timestep of the last model run can be used if the parameters havent changed
+  //this is not possible if any of the parameters are based on the stock data
+  int check = 1;
+  if ((TimeInfo->getTime() == 1) && (!this->usesStockData())) {
+    check = (parchanged || calctime != 1);
+    parchanged = 0;
+  }
+
   if (readoption == 0) {
     mortality.Update(TimeInfo);
-    if (mortality.didChange(TimeInfo) || TimeInfo->didStepSizeChange()) {
+    if ((check) && (mortality.didChange(TimeInfo) || TimeInfo->didStepSizeChange())) {
       int i, j;
+      calctime = TimeInfo->getTime();
       for (i = 0; i < proportion.Nrow(); i++) {
         for (j = 0; j < proportion.Ncol(i); j++) {
           if (mortality[j] > verysmall)
@@ -68,9 +81,10 @@ void NaturalMortality::Reset(const TimeClass* const TimeInfo) {
   } else if (readoption == 1) {
     //JMB experimental mortality function
     fnMortality->updateConstants(TimeInfo);
-    if (fnMortality->didChange(TimeInfo) || TimeInfo->didStepSizeChange()) {
+    if ((check) && (fnMortality->didChange(TimeInfo) || TimeInfo->didStepSizeChange())) {
       int i, j;
       double m;
+      calctime = TimeInfo->getTime();
       for (i = 0; i < proportion.Nrow(); i++) {
         for (j = 0; j < proportion.Ncol(i); j++) {
           m = fnMortality->calculate(double(minStockAge + j));
@@ -89,6 +103,12 @@ void NaturalMortality::Reset(const TimeClass* const TimeInfo) {
     handle.logMessage(LOGFAIL, "Error in natural mortality - unrecognised mortality function", readoption);
 }
 
+int NaturalMortality::usesStockData() const {
+  if (readoption == 1)
+    return fnMortality->usesStockData();
+  return mortality.usesStockData();
+}
+
 void NaturalMortality::Print(ofstream& outfile) {
   int i;
   outfile << "Natural mortality\n\t";
@@ -3,9 +3,9 @@
 #include "gadget.h"
 #include "global.h"
 
-OptInfoBFGS::OptInfoBFGS()
-  : OptInfo(), bfgsiter(10000), bfgseps(0.01), beta(0.3), sigma(0.01),
-    step(1.0), gradacc(1e-6), gradstep(0.5), gradeps(1e-10) {
+OptInfoBFGS::OptInfoBFGS(Ecosystem* const eco)
+  : OptInfo(eco), bfgsiter(10000), bfgseps(0.01), beta(0.3), sigma(0.01),
+    step(1.0), gradacc(1e-6), gradstep(0.5), gradeps(1e-10), gradcentral(0.0) {
   type = OPTBFGS;
   handle.logMessage(LOGMESSAGE, "Initialising BFGS optimisation algorithm");
 }
@@ -14,7 +14,7 @@ void OptInfoBFGS::read(CommentStream& infile, char* text) {
   handle.logMessage(LOGMESSAGE, "Reading BFGS optimisation parameters");
 
   int count = 0;
-  while (!infile.eof() && strcasecmp(text, "[simann]") && strcasecmp(text, "[hooke]") && strcasecmp(text, "[bfgs]")) {
+  while (!infile.eof() && strcasecmp(text, "[simann]") && strcasecmp(text, "[ptsimann]") && strcasecmp(text, "[hooke]") && strcasecmp(text, "[bfgs]")) {
     infile >> ws;
     if (strcasecmp(text, "seed") == 0) {
       int seed = 0;
@@ -46,6 +46,15 @@ void OptInfoBFGS::read(CommentStream& infile, char* text) {
       infile >> gradeps;
       count++;
 
+    } else if (strcasecmp(text, "gradcentral") == 0) {
+      infile >> gradcentral;
+      count++;
+
+    } else if (strcasecmp(text, "bfgsthreads") == 0) {
+      infile >> threads;
+      threadsgiven = 1;
+      count++;
+
     } else if ((strcasecmp(text, "bfgsiter") == 0) || (strcasecmp(text, "maxiter") == 0)) {
       infile >> bfgsiter;
       count++;
@@ -93,6 +102,18 @@ void OptInfoBFGS::read(CommentStream& infile, char* text) {
     handle.logMessage(LOGINFO, "Warning in optinfofile - value of gradeps outside bounds", gradeps);
     gradeps = 1e-10;
   }
+  if ((gradcentral < 0.0) || (gradcentral > 1.0)) {
+    handle.logMessage(LOGINFO, "Warning in optinfofile - value of gradcentral outside bounds", gradcentral);
+    gradcentral = 0.0;
+  }
+  if (threads < 1) {
+    handle.logMessage(LOGINFO, "Warning in optinfofile - value of bfgsthreads outside bounds", threads);
+    threads = 1;
+  }
+#ifndef GADGET_THREADS
+  if (threads > 1)
+    handle.logMessage(LOGINFO, "Warning - Gadget was compiled without thread support, so the model will be evaluated serially");
+#endif
 }
 
 void OptInfoBFGS::Print(ofstream& outfile, int prec) {
@@ -3,8 +3,8 @@
 #include "gadget.h"
 #include "global.h"
 
-OptInfoHooke::OptInfoHooke()
-  : OptInfo(), hookeiter(1000), rho(0.5), lambda(0.0), hookeeps(1e-4), bndcheck(0.9999) {
+OptInfoHooke::OptInfoHooke(Ecosystem* const eco)
+  : OptInfo(eco), hookeiter(1000), rho(0.5), lambda(0.0), hookeeps(1e-4), bndcheck(0.9999) {
   type = OPTHOOKE;
   handle.logMessage(LOGMESSAGE, "Initialising Hooke & Jeeves optimisation algorithm");
 }
@@ -13,7 +13,7 @@ void OptInfoHooke::read(CommentStream& infile, char* text) {
   handle.logMessage(LOGMESSAGE, "Reading Hooke & Jeeves optimisation parameters");
 
   int count = 0;
-  while (!infile.eof() && strcasecmp(text, "[simann]") && strcasecmp(text, "[hooke]") && strcasecmp(text, "[bfgs]")) {
+  while (!infile.eof() && strcasecmp(text, "[simann]") && strcasecmp(text, "[ptsimann]") && strcasecmp(text, "[hooke]") && strcasecmp(text, "[bfgs]")) {
     infile >> ws;
     if (strcasecmp(text, "seed") == 0) {
       int seed = 0;
@@ -41,6 +41,11 @@ void OptInfoHooke::read(CommentStream& infile, char* text) {
       infile >> bndcheck;
       count++;
 
+    } else if (strcasecmp(text, "hookethreads") == 0) {
+      infile >> threads;
+      threadsgiven = 1;
+      count++;
+
     } else {
       handle.logMessage(LOGINFO, "Warning in optinfofile - unrecognised option", text);
       infile >> text;  //read and ignore the next entry
@@ -68,6 +73,14 @@ void OptInfoHooke::read(CommentStream& infile, char* text) {
     handle.logMessage(LOGINFO, "Warning in optinfofile - value of hookeeps outside bounds", hookeeps);
     hookeeps = 1e-4;
   }
+  if (threads < 1) {
+    handle.logMessage(LOGINFO, "Warning in optinfofile - value of hookethreads outside bounds", threads);
+    threads = 1;
+  }
+#ifndef GADGET_THREADS
+  if (threads > 1)
+    handle.logMessage(LOGINFO, "Warning - Gadget was compiled without thread support, so the model will be evaluated serially");
+#endif
 }
 
 void OptInfoHooke::Print(ofstream& outfile, int prec) {
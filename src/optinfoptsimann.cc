@@ -0,0 +1,157 @@
+#include "optinfo.h"
+#include "errorhandler.h"
+#include "gadget.h"
+#include "global.h"
+
+OptInfoPTSimann::OptInfoPTSimann(Ecosystem* const eco)
+  : OptInfo(eco), rt(0.85), ptsimanneps(1e-4), ns(5), nt(2), t(100.0), tratio(2.0), cs(2.0),
+    vminit(1.0), ptsimanniter(2000), uratio(0.7), lratio(0.3), tempcheck(4), scale(0) {
+  type = OPTPTSIMANN;
+  threads = 4;
+  handle.logMessage(LOGMESSAGE, "Initialising Parallel Tempering Simulated Annealing optimisation algorithm");
+}
+
+void OptInfoPTSimann::read(CommentStream& infile, char* text) {
+  handle.logMessage(LOGMESSAGE, "Reading Parallel Tempering Simulated Annealing optimisation parameters");
+
+  int count = 0;
+  while (!infile.eof() && strcasecmp(text, "[simann]") && strcasecmp(text, "[ptsimann]") && strcasecmp(text, "[hooke]") && strcasecmp(text, "[bfgs]")) {
+    infile >> ws;
+    if (strcasecmp(text, "seed") == 0) {
+      int seed = 0;
+      infile >> seed >> ws;
+      handle.logMessage(LOGMESSAGE, "Initialising random number generator with", seed);
+      srand(seed);
+
+    } else if (strcasecmp(text, "ptsimanniter") == 0) {
+      infile >> ptsimanniter;
+      count++;
+
+    } else if (strcasecmp(text, "ptchains") == 0) {
+      infile >> threads;
+      count++;
+
+    } else if (strcasecmp(text, "t") == 0) {
+      infile >> t;
+      count++;
+
+    } else if (strcasecmp(text, "tratio") == 0) {
+      infile >> tratio;
+      count++;
+
+    } else if (strcasecmp(text, "rt") == 0) {
+      infile >> rt;
+      count++;
+
+    } else if (strcasecmp(text, "ptsimanneps") == 0) {
+      infile >> ptsimanneps;
+      count++;
+
+    } else if (strcasecmp(text, "nt") == 0) {
+      infile >> nt;
+      count++;
+
+    } else if (strcasecmp(text, "ns") == 0) {
+      infile >> ns;
+      count++;
+
+    } else if (strcasecmp(text, "vm") == 0) {
+      infile >> vminit;
+      count++;
+
+    } else if (strcasecmp(text, "cstep") == 0) {
+      infile >> cs;
+      count++;
+
+    } else if (strcasecmp(text, "check") == 0) {
+      infile >> tempcheck;
+      count++;
+
+    } else if (strcasecmp(text, "uratio") == 0) {
+      infile >> uratio;
+      count++;
+
+    } else if (strcasecmp(text, "lratio") == 0) {
+      infile >> lratio;
+      count++;
+
+    } else if (strcasecmp(text, "scale") == 0) {
+      infile >> scale;
+      count++;
+
+    } else {
+      handle.logMessage(LOGINFO, "Warning in optinfofile - unrecognised option", text);
+      infile >> text;  //read and ignore the next entry
+    }
+    infile >> text;
+  }
+
+  if (count == 0)
+    handle.logMessage(LOGINFO, "Warning - no parameters specified for Parallel Tempering Simulated Annealing optimisation algorithm");
+
+  //check the values specified in the optinfo file ...
+  if ((uratio < 0.5) || (uratio > 1.0)) {
+    handle.logMessage(LOGINFO, "Warning in optinfofile - value of uratio outside bounds", uratio);
+    uratio = 0.7;
+  }
+  if ((lratio < rathersmall) || (lratio > 0.5)) {
+    handle.logMessage(LOGINFO, "Warning in optinfofile - value of lratio outside bounds", lratio);
+    lratio = 0.3;
+  }
+  if ((rt < rathersmall) || (rt > 1.0)) {
+    handle.logMessage(LOGINFO, "Warning in optinfofile - value of rt outside bounds", rt);
+    rt = 0.85;
+  }
+  if (t < rathersmall) {
+    handle.logMessage(LOGINFO, "Warning in optinfofile - value of t outside bounds", t);
+    t = 100.0;
+  }
+  if (tratio < 1.0) {
+    handle.logMessage(LOGINFO, "Warning in optinfofile - value of tratio outside bounds", tratio);
+    tratio = 2.0;
+  }
+  if (threads < 2) {
+    handle.logMessage(LOGINFO, "Warning in optinfofile - value of ptchains outside bounds", threads);
+    threads = 4;
+  }
+  if (nt < 1) {
+    handle.logMessage(LOGINFO, "Warning in optinfofile - value of nt outside bounds", nt);
+    nt = 2;
+  }
+  if (ns < 1) {
+    handle.logMessage(LOGINFO, "Warning in optinfofile - value of ns outside bounds", ns);
+    ns = 5;
+  }
+  if (tempcheck < 1) {
+    handle.logMessage(LOGINFO, "Warning in optinfofile - value of check outside bounds", tempcheck);
+    tempcheck = 4;
+  }
+  if (vminit < rathersmall) {
+    handle.logMessage(LOGINFO, "Warning in optinfofile - value of vm outside bounds", vminit);
+    vminit = 1.0;
+  }
+  if (cs < rathersmall) {
+    handle.logMessage(LOGINFO, "Warning in optinfofile - value of cstep outside bounds", cs);
+    cs = 2.0;
+  }
+  if (ptsimanneps < rathersmall) {
+    handle.logMessage(LOGINFO, "Warning in optinfofile - value of ptsimanneps outside bounds", ptsimanneps);
+    ptsimanneps = 1e-4;
+  }
+  if (scale != 0 && scale != 1) {
+    handle.logMessage(LOGINFO, "Warning in optinfofile - value of scale outside bounds", scale);
+    scale = 0;
+  }
+}
+
+void OptInfoPTSimann::Print(ofstream& outfile, int prec) {
+  outfile << "; Parallel Tempering Simulated Annealing algorithm ran for " << iters
+    << " function evaluations\n; and stopped when the likelihood value was "
+    << setprecision(prec) << score;
+  if (converge == -1)
+    outfile << "\n; because an error occured during the optimisation\n";
+  else if (converge == 1)
+    outfile << "\n; because the convergence criteria were met\n";
+  else
+    outfile << "\n; because the maximum number of function evaluations was reached\n";
+}
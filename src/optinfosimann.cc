@@ -3,8 +3,8 @@
 #include "gadget.h"
 #include "global.h"
 
-OptInfoSimann::OptInfoSimann()
-  : OptInfo(), rt(0.85), simanneps(1e-4), ns(5), nt(2), t(100.0), cs(2.0),
+OptInfoSimann::OptInfoSimann(Ecosystem* const eco)
+  : OptInfo(eco), rt(0.85), simanneps(1e-4), ns(5), nt(2), t(100.0), cs(2.0),
     vminit(1.0), simanniter(2000), uratio(0.7), lratio(0.3), tempcheck(4), scale(0) {
   type = OPTSIMANN;
   handle.logMessage(LOGMESSAGE, "Initialising Simulated Annealing optimisation algorithm");
@@ -14,7 +14,7 @@ void OptInfoSimann::read(CommentStream& infile, char* text) {
   handle.logMessage(LOGMESSAGE, "Reading Simulated Annealing optimisation parameters");
 
   int count = 0;
-  while (!infile.eof() && strcasecmp(text, "[simann]") && strcasecmp(text, "[hooke]") && strcasecmp(text, "[bfgs]")) {
+  while (!infile.eof() && strcasecmp(text, "[simann]") && strcasecmp(text, "[ptsimann]") && strcasecmp(text, "[hooke]") && strcasecmp(text, "[bfgs]")) {
     infile >> ws;
     if (strcasecmp(text, "seed") == 0) {
       int seed = 0;
@@ -0,0 +1,209 @@
+#include "ecosystem.h"
+#include "errorhandler.h"
+#include "gadget.h"
+#include "global.h"
+
+void Ecosystem::simulateBatch() {
+  int i, j;
+  for (i = batchstart; i < batchpoints->Nrow(); i += batchstep) {
+    keeper->Update((*batchpoints)[i]);
+    this->Simulate(0);  //dont print whilst optimising
+
+    (*batchscores)[i] = likelihood;
+    for (j = 0; j < likevec.Size(); j++)
+      (*batchlikes)[i][j] = likevec[j]->getUnweightedLikelihood();
+    keeper->getCurrentValues((*batchvalues)[i]);
+  }
+}
+
+void* Ecosystem::runBatch(void* eco) {
+  //the messages from this thread are sent to the ErrorHandler for the worker copy of the model
+  ErrorHandler::setActive(((Ecosystem*)eco)->errorhandler);
+  ((Ecosystem*)eco)->simulateBatch();
+  return NULL;
+}
+
+void Ecosystem::simulatePoints(const DoubleMatrix& points, DoubleVector& f, DoubleMatrix& likes, DoubleMatrix& values) {
+  int i;
+  if (farmfd.Size() > 0) {
+    this->simulateFarm(points, f, likes, values);
+    return;
+  }
+
+#ifdef GADGET_THREADS
+  if (workers.Size() > 0) {
+    int numinst = workers.Size() + 1;
+    if (numinst > points.Nrow())
+      numinst = points.Nrow();
+
+    //share the points between this model and the worker copies of the model
+    Ecosystem* eco;
+    for (i = 0; i < numinst; i++) {
+      eco = (i == 0 ? this : workers[i - 1]);
+      if (i != 0)
+        eco->keeper->Update(keeper);
+      eco->batchpoints = &points;
+      eco->batchlikes = &likes;
+      eco->batchvalues = &values;
+      eco->batchscores = &f;
+      eco->batchstart = i;
+      eco->batchstep = numinst;
+    }
+
+    pthread_t* threads = new pthread_t[numinst - 1];
+    for (i = 1; i < numinst; i++)
+      if (pthread_create(&threads[i - 1], NULL, Ecosystem::runBatch, workers[i - 1]) != 0)
+        handle.logMessage(LOGFAIL, "Error in ecosystem - failed to create thread for worker", i);
+
+    this->simulateBatch();
+    for (i = 1; i < numinst; i++)
+      pthread_join(threads[i - 1], NULL);
+    delete[] threads;
+    return;
+  }
+#endif
+
+  //no worker copies of the model, so run the points in this model
+  batchpoints = &points;
+  batchlikes = &likes;
+  batchvalues = &values;
+  batchscores = &f;
+  batchstart = 0;
+  batchstep = 1;
+  this->simulateBatch();
+}
+
+void Ecosystem::SimulateAndUpdate(const DoubleMatrix& x, DoubleVector& f) {
+  int i, j, numrun;
+  if (f.Size() != x.Nrow())
+    handle.logMessage(LOGFAIL, "Error in ecosystem - received wrong number of points to simulate");
+
+  if ((x.Nrow() > 1) && ((farmfd.Size() > 0) || (workers.Size() > 0))) {
+    DoubleMatrix points(x.Nrow(), keeper->numVariables(), 0.0);
+    DoubleMatrix likes(x.Nrow(), likevec.Size(), 0.0);
+    DoubleMatrix values(x.Nrow(), keeper->numVariables(), 0.0);
+    IntVector entry(x.Nrow(), -1);
+    numrun = 0;
+    for (i = 0; i < x.Nrow(); i++) {
+      this->convertScaledValues(x[i], points[i]);
+      entry[i] = evalcache.Find(points[i]);
+      if (entry[i] < 0)
+        numrun++;
+    }
+
+    //only the points that arent stored in the evaluation cache are run
+    if (numrun > 0) {
+      DoubleMatrix runpoints(numrun, keeper->numVariables(), 0.0);
+      DoubleMatrix runlikes(numrun, likevec.Size(), 0.0);
+      DoubleMatrix runvalues(numrun, keeper->numVariables(), 0.0);
+      DoubleVector runf(numrun, 0.0);
+      j = 0;
+      for (i = 0; i < x.Nrow(); i++) {
+        if (entry[i] < 0) {
+          runpoints[j] = points[i];
+          j++;
+        }
+      }
+
+      this->simulatePoints(runpoints, runf, runlikes, runvalues);
+      j = 0;
+      for (i = 0; i < x.Nrow(); i++) {
+        if (entry[i] < 0) {
+          f[i] = runf[j];
+          likes[i] = runlikes[j];
+          values[i] = runvalues[j];
+          j++;
+        }
+      }
+    }
+
+    for (i = 0; i < x.Nrow(); i++) {
+      if (entry[i] >= 0) {
+        f[i] = evalcache.getScore(entry[i]);
+        likes[i] = evalcache.getLikelihoods(entry[i]);
+        values[i] = evalcache.getValues(entry[i]);
+      }
+    }
+
+    //the batch model runs are never stopped early, so all the scores can be stored
+    for (i = 0; i < x.Nrow(); i++)
+      if (entry[i] < 0)
+        evalcache.Store(points[i], values[i], f[i], likes[i]);
+
+    checkresumed = 0;
+    cachehit = 0;
+
+    //update the counters and the output file in the order the points were given
+    for (i = 0; i < x.Nrow(); i++) {
+      likelihood = f[i];
+      if (printinfo.getPrint()) {
+        printcount++;
+        if (printcount == printinfo.getPrintIteration()) {
+          keeper->writeValues(values[i], likes[i], funceval, likelihood, printinfo.getPrecision());
+          printcount = 0;
+        }
+      }
+      funceval++;
+    }
+    return;
+  }
+
+  for (i = 0; i < x.Nrow(); i++)
+    f[i] = this->SimulateAndUpdate(x[i]);
+}
+
+void Ecosystem::SimulateRepeatedValues(StochasticData* const data, int print) {
+  int i, numinst;
+
+  //the model output can only be printed if each line is run by this model in turn
+  numinst = (farmfd.Size() > 0 ? farmfd.Size() : workers.Size() + 1);
+  if ((numinst == 1) || ((print) && (printvec.Size() > 0))) {
+    if (numinst > 1)
+      handle.logMessage(LOGWARN, "Warning - model output is printed, so the parameter values will be run serially");
+
+    while (data->isDataLeft()) {
+      data->readNextLine();
+      this->Update(data);
+      this->checkBounds();
+      this->Simulate(print);
+      if (printinfo.getPrint())
+        this->writeValues();
+    }
+    return;
+  }
+
+  handle.logMessage(LOGMESSAGE, "Running the parameter values in batches, number of model instances", numinst);
+  DoubleVector lastval(keeper->numVariables(), 0.0);
+  while (data->isDataLeft()) {
+    //read the next batch of lines from the parameter file
+    DoubleMatrix points;
+    while ((data->isDataLeft()) && (points.Nrow() < numinst * REPEATBATCH)) {
+      data->readNextLine();
+      this->Update(data);
+      this->checkBounds();
+      keeper->getCurrentValues(lastval);
+
+      //the last line in the file is run by this model, so the final state is correct
+      if (data->isDataLeft()) {
+        points.AddRows(1, keeper->numVariables(), 0.0);
+        points[points.Nrow() - 1] = lastval;
+      }
+    }
+
+    if (points.Nrow() > 0) {
+      DoubleVector f(points.Nrow(), 0.0);
+      DoubleMatrix likes(points.Nrow(), likevec.Size(), 0.0);
+      DoubleMatrix values(points.Nrow(), keeper->numVariables(), 0.0);
+      this->simulatePoints(points, f, likes, values);
+
+      if (printinfo.getPrint())
+        for (i = 0; i < points.Nrow(); i++)
+          keeper->writeValues(values[i], likes[i], funceval, f[i], printinfo.getPrecision());
+    }
+  }
+
+  keeper->Update(lastval);
+  this->Simulate(print);
+  if (printinfo.getPrint())
+    this->writeValues();
+}
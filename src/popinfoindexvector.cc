@@ -1,7 +1,10 @@
 #include "popinfoindexvector.h"
+#include "errorhandler.h"
 #include "gadget.h"
+#include "global.h"
 
 PopInfoIndexVector::PopInfoIndexVector(int sz, int minp) {
+  owner = 1;
   size = (sz > 0 ? sz : 0);
   minpos = minp;
   if (size > 0)
@@ -11,6 +14,7 @@ PopInfoIndexVector::PopInfoIndexVector(int sz, int minp) {
 }
 
 PopInfoIndexVector::PopInfoIndexVector(int sz, int minp, PopInfo value) {
+  owner = 1;
   size = (sz > 0 ? sz : 0);
   minpos = minp;
   int i;
@@ -23,6 +27,7 @@ PopInfoIndexVector::PopInfoIndexVector(int sz, int minp, PopInfo value) {
 }
 
 PopInfoIndexVector::PopInfoIndexVector(const PopInfoIndexVector& initial) {
+  owner = 1;
   size = initial.size;
   minpos = initial.minpos;
   int i;
@@ -34,16 +39,34 @@ PopInfoIndexVector::PopInfoIndexVector(const PopInfoIndexVector& initial) {
     v = 0;
 }
 
+PopInfoIndexVector::PopInfoIndexVector(int sz, int minp, PopInfo* store) {
+  owner = 0;
+  size = (sz > 0 ? sz : 0);
+  minpos = minp;
+  v = (size > 0 ? store : 0);
+}
+
 PopInfoIndexVector::~PopInfoIndexVector() {
-  if (v != 0) {
+  if ((v != 0) && (owner)) {
     delete[] v;
     v = 0;
   }
 }
 
+void PopInfoIndexVector::setStore(int sz, int minp, PopInfo* store) {
+  if ((v != 0) && (owner))
+    delete[] v;
+  owner = 0;
+  size = (sz > 0 ? sz : 0);
+  minpos = minp;
+  v = (size > 0 ? store : 0);
+}
+
 void PopInfoIndexVector::resize(int addsize, int lower, PopInfo initial) {
   if (addsize <= 0)
     return;
+  if (!owner)
+    handle.logMessage(LOGFAIL, "Error in popinfoindexvector - cannot resize a vector that does not own its memory");
 
   int i;
   if (v == 0) {
@@ -120,7 +120,9 @@ void Predator::readSuitability(CommentStream& infile,
     infile >> text >> ws;
     if (strcasecmp(text, "function") == 0) {
       infile >> text >> ws;
+      keeper->setDependency(suitable->getChangedFlag());
       suitf.readSuitFunction(infile, text, TimeInfo, keeper);
+      keeper->clearDependency();
       suitable->addPrey(preyname, suitf[i++]);
 
     } else if (strcasecmp(text, "suitfile") == 0) {
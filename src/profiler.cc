@@ -0,0 +1,113 @@
+#include "profiler.h"
+#include "errorhandler.h"
+#include "mathfunc.h"
+#include "runid.h"
+#include "gadget.h"
+#include "global.h"
+
+#ifdef NOT_WINDOWS
+#include <sys/time.h>
+#endif
+
+Profiler::Profiler() {
+  active = 0;
+  numruns = 0;
+#ifdef GADGET_THREADS
+  pthread_mutex_init(&timemutex, NULL);
+#endif
+}
+
+Profiler::~Profiler() {
+  int i;
+  for (i = 0; i < names.Size(); i++) {
+    delete[] types[i];
+    delete[] names[i];
+  }
+#ifdef GADGET_THREADS
+  pthread_mutex_destroy(&timemutex);
+#endif
+}
+
+void Profiler::addTime(int id, double time) {
+#ifdef GADGET_THREADS
+  pthread_mutex_lock(&timemutex);
+  runtime[id] += time;
+  pthread_mutex_unlock(&timemutex);
+#else
+  runtime[id] += time;
+#endif
+}
+
+double Profiler::getTime() {
+#ifdef NOT_WINDOWS
+  struct timeval tv;
+  gettimeofday(&tv, NULL);
+  return (double(tv.tv_sec) + double(tv.tv_usec) * 1e-6);
+#else
+  return (double(clock()) / CLOCKS_PER_SEC);
+#endif
+}
+
+int Profiler::addEntry(const char* type, const char* name) {
+  types.resize(new char[strlen(type) + 1]);
+  strcpy(types[types.Size() - 1], type);
+  names.resize(new char[strlen(name) + 1]);
+  strcpy(names[names.Size() - 1], name);
+  runtime.resize(1, 0.0);
+  return (runtime.Size() - 1);
+}
+
+void Profiler::addProfile(const Profiler& pro) {
+  int i;
+  if (pro.runtime.Size() != runtime.Size())
+    handle.logMessage(LOGFAIL, "Error in profiler - received wrong number of entries to add");
+
+  for (i = 0; i < runtime.Size(); i++)
+    runtime[i] += pro.runtime[i];
+  numruns += pro.numruns;
+}
+
+void Profiler::Print() const {
+  int i;
+  double total;
+  char text[MaxStrLength];
+  strncpy(text, "", MaxStrLength);
+
+  if (runtime.Size() == 0)
+    return;
+
+  //the percentages are given relative to the first entry, which should cover the whole model run
+  total = (isZero(runtime[0]) ? 1.0 : runtime[0]);
+  handle.logMessage(LOGINFO, "\nTime spent in each part of the model simulation, number of model runs", numruns);
+  sprintf(text, "%-12s %-30s %12s %12s %8s", "type", "name", "seconds", "ms per run", "percent");
+  handle.logMessage(LOGINFO, text);
+  for (i = 0; i < runtime.Size(); i++) {
+    sprintf(text, "%-12.12s %-30.30s %12.3f %12.3f %8.2f", types[i], names[i], runtime[i],
+      (numruns > 0 ? runtime[i] * 1000.0 / numruns : 0.0), runtime[i] * 100.0 / total);
+    handle.logMessage(LOGINFO, text);
+  }
+}
+
+void Profiler::writeFile(const char* filename) const {
+  int i;
+  double total;
+  ofstream outfile;
+  outfile.open(filename, ios::out);
+  handle.checkIfFailure(outfile, filename);
+  handle.Open(filename);
+
+  total = ((runtime.Size() == 0) || isZero(runtime[0]) ? 1.0 : runtime[0]);
+  outfile << "; ";
+  RUNID.Print(outfile);
+  outfile << "; Time spent in each part of the model simulation over " << numruns << " model runs\n"
+    << "; -- data --\n; type name seconds ms-per-run percent\n";
+  outfile.setf(ios::fixed);
+  for (i = 0; i < runtime.Size(); i++)
+    outfile << types[i] << TAB << names[i] << TAB << setprecision(smallprecision)
+      << runtime[i] << TAB << (numruns > 0 ? runtime[i] * 1000.0 / numruns : 0.0)
+      << TAB << runtime[i] * 100.0 / total << endl;
+
+  handle.Close();
+  outfile.close();
+  outfile.clear();
+}
@@ -0,0 +1,312 @@
+/* This is a parallel tempering version of the Simulated Annealing         */
+/* algorithm in simann.cc.  A number of chains are run in lockstep, each   */
+/* at a different temperature, so that the trial points for all the chains */
+/* can be evaluated as one batch of model simulations.  After each sweep   */
+/* through the parameters, neighbouring chains attempt to exchange their   */
+/* points using the Metropolis criteria for the difference in temperature, */
+/* see Geyer, "Markov Chain Monte Carlo Maximum Likelihood" (1991) and     */
+/* Earl and Deem, "Parallel tempering: Theory, applications, and new       */
+/* perspectives", Phys. Chem. Chem. Phys. 7 (2005) pp. 3910-3916.         */
+/*                                                                          */
+/* The step length adjustment and the termination criteria follow the      */
+/* Corana et al. algorithm used in simann.cc, applied to the coldest chain */
+
+#include "gadget.h"    //All the required standard header files are in here
+#include "optinfo.h"
+#include "mathfunc.h"
+#include "doublevector.h"
+#include "doublematrix.h"
+#include "intvector.h"
+#include "intmatrix.h"
+#include "errorhandler.h"
+#include "ecosystem.h"
+#include "global.h"
+
+void OptInfoPTSimann::OptimiseLikelihood() {
+
+  //set initial values
+  int nacc = 0;         //The number of accepted function evaluations
+  int nrej = 0;         //The number of rejected function evaluations
+  int naccmet = 0;      //The number of metropolis accepted function evaluations
+  int nswap = 0;        //The number of accepted exchanges between chains
+
+  double tmp, p, pp, ratio, nsdiv;
+  double fopt, startf;
+  int    a, c, i, j, k, l, offset, quit, newopt;
+  int    rchange, rcheck, rnumber;  //Used to randomise the order of the parameters
+
+  handle.logMessage(LOGINFO, "\nStarting Parallel Tempering Simulated Annealing optimisation algorithm\n");
+  int nvars = EcoSystem->numOptVariables();
+  int nchains = threads;
+  DoubleMatrix x(nchains, nvars, 0.0);
+  DoubleMatrix trialx(nchains, nvars, 0.0);
+  DoubleMatrix vm(nchains, nvars, vminit);
+  IntMatrix nacp(nchains, nvars, 0);
+  DoubleVector funcval(nchains, 0.0);
+  DoubleVector trialf(nchains, 0.0);
+  DoubleVector temp(nchains, 0.0);
+  DoubleVector start(nvars);
+  DoubleVector init(nvars);
+  DoubleVector bestx(nvars);
+  DoubleVector scalex(nvars);
+  DoubleVector lowerb(nvars);
+  DoubleVector upperb(nvars);
+  DoubleVector fstar(tempcheck);
+  IntVector param(nvars, 0);
+
+  EcoSystem->resetVariables();  //JMB need to reset variables in case they have been scaled
+  if (scale)
+    EcoSystem->scaleVariables();
+  EcoSystem->getOptScaledValues(start);
+  EcoSystem->getOptLowerBounds(lowerb);
+  EcoSystem->getOptUpperBounds(upperb);
+  EcoSystem->getOptInitialValues(init);
+
+  for (i = 0; i < nvars; i++) {
+    bestx[i] = start[i];
+    param[i] = i;
+  }
+
+  if (scale) {
+    for (i = 0; i < nvars; i++) {
+      scalex[i] = start[i];
+      // Scaling the bounds, because the parameters are scaled
+      lowerb[i] = lowerb[i] / init[i];
+      upperb[i] = upperb[i] / init[i];
+      if (lowerb[i] > upperb[i]) {
+        tmp = lowerb[i];
+        lowerb[i] = upperb[i];
+        upperb[i] = tmp;
+      }
+    }
+  }
+
+  //startf is the function value at the starting point, shared by all the chains
+  startf = EcoSystem->SimulateAndUpdate(start);
+  if (startf != startf) { //check for NaN
+    handle.logMessage(LOGINFO, "Error starting Parallel Tempering Simulated Annealing optimisation with f(x) = infinity");
+    converge = -1;
+    iters = 1;
+    return;
+  }
+
+  //each chain is at a higher temperature than the previous chain
+  for (c = 0; c < nchains; c++) {
+    for (i = 0; i < nvars; i++)
+      x[c][i] = start[i];
+    funcval[c] = startf;
+    temp[c] = (c == 0 ? t : temp[c - 1] * tratio);
+  }
+
+  handle.logMessage(LOGINFO, "Running the optimisation with", nchains, "chains");
+  offset = EcoSystem->getFuncEval();  //number of function evaluations done before loop
+  nacc++;
+  cs /= lratio;  //JMB save processing time
+  nsdiv = 1.0 / ns;
+  fopt = startf;
+  for (i = 0; i < tempcheck; i++)
+    fstar[i] = startf;
+
+  //Start the main loop.  Note that it terminates if
+  //(i) the algorithm succesfully optimises the function or
+  //(ii) there are too many function evaluations
+  while (1) {
+    for (a = 0; a < nt; a++) {
+      //Randomize the order of the parameters once in a while, to avoid
+      //the order having an influence on which changes are accepted
+      rchange = 0;
+      while (rchange < nvars) {
+        rnumber = rand() % nvars;
+        rcheck = 1;
+        for (i = 0; i < rchange; i++)
+          if (param[i] == rnumber)
+            rcheck = 0;
+        if (rcheck) {
+          param[rchange] = rnumber;
+          rchange++;
+        }
+      }
+
+      for (j = 0; j < ns; j++) {
+        for (l = 0; l < nvars; l++) {
+          //Generate trialx, the trial value of x, for each chain
+          for (c = 0; c < nchains; c++) {
+            for (i = 0; i < nvars; i++)
+              trialx[c][i] = x[c][i];
+
+            i = param[l];
+            trialx[c][i] = x[c][i] + ((randomNumber() * 2.0) - 1.0) * vm[c][i];
+
+            //If trialx is out of bounds, try again until we find a point that is OK
+            k = 0;
+            while ((trialx[c][i] < lowerb[i]) || (trialx[c][i] > upperb[i])) {
+              trialx[c][i] = x[c][i] + ((randomNumber() * 2.0) - 1.0) * vm[c][i];
+              k++;
+              if (k > 10)  //we've had 10 tries to find a point neatly, so give up
+                trialx[c][i] = lowerb[i] + (upperb[i] - lowerb[i]) * randomNumber();
+            }
+          }
+
+          //Evaluate the trial points for all the chains as one batch
+          EcoSystem->SimulateAndUpdate(trialx, trialf);
+          iters = EcoSystem->getFuncEval() - offset;
+
+          newopt = -1;
+          for (c = 0; c < nchains; c++) {
+            //Accept the new point if the new function value better
+            if ((funcval[c] - trialf[c]) > verysmall) {
+              for (i = 0; i < nvars; i++)
+                x[c][i] = trialx[c][i];
+              funcval[c] = trialf[c];
+              nacc++;
+              nacp[c][param[l]]++;
+
+            } else {
+              //Accept according to metropolis condition
+              p = expRep((funcval[c] - trialf[c]) / temp[c]);
+              pp = randomNumber();
+              if (pp < p) {
+                //Accept point
+                for (i = 0; i < nvars; i++)
+                  x[c][i] = trialx[c][i];
+                funcval[c] = trialf[c];
+                naccmet++;
+                nacp[c][param[l]]++;
+              } else {
+                //Reject point
+                nrej++;
+              }
+            }
+
+            // JMB added check for really silly values
+            if (isZero(trialf[c])) {
+              handle.logMessage(LOGINFO, "Error in Parallel Tempering Simulated Annealing optimisation after", iters, "function evaluations, f(x) = 0");
+              converge = -1;
+              return;
+            }
+
+            //If better than any other point, record as new optimum
+            if ((trialf[c] < fopt) && (trialf[c] == trialf[c])) {
+              fopt = trialf[c];
+              newopt = c;
+            }
+          }
+
+          if (newopt >= 0) {
+            for (i = 0; i < nvars; i++)
+              bestx[i] = trialx[newopt][i];
+
+            if (scale) {
+              for (i = 0; i < nvars; i++)
+                scalex[i] = bestx[i] * init[i];
+              EcoSystem->storeVariables(fopt, scalex);
+            } else
+              EcoSystem->storeVariables(fopt, bestx);
+
+            handle.logMessage(LOGINFO, "\nNew optimum found after", iters, "function evaluations");
+            handle.logMessage(LOGINFO, "The likelihood score is", fopt, "at the point");
+            EcoSystem->writeBestValues();
+          }
+
+          //If too many function evaluations occur, terminate the algorithm
+          if (iters > ptsimanniter) {
+            handle.logMessage(LOGINFO, "\nStopping Parallel Tempering Simulated Annealing optimisation algorithm\n");
+            handle.logMessage(LOGINFO, "The optimisation stopped after", iters, "function evaluations");
+            handle.logMessage(LOGINFO, "The temperature was reduced to", temp[0]);
+            handle.logMessage(LOGINFO, "The optimisation stopped because the maximum number of function evaluations");
+            handle.logMessage(LOGINFO, "was reached and NOT because an optimum was found for this run");
+            handle.logMessage(LOGINFO, "Number of directly accepted points", nacc);
+            handle.logMessage(LOGINFO, "Number of metropolis accepted points", naccmet);
+            handle.logMessage(LOGINFO, "Number of rejected points", nrej);
+            handle.logMessage(LOGINFO, "Number of exchanges between chains", nswap);
+
+            score = EcoSystem->SimulateAndUpdate(bestx);
+            handle.logMessage(LOGINFO, "\nParallel Tempering Simulated Annealing finished with a likelihood score of", score);
+            return;
+          }
+        }
+
+        //Attempt to exchange the points of neighbouring chains, alternating
+        //between the even and odd pairs of chains after each sweep
+        for (c = (j % 2); c < nchains - 1; c += 2) {
+          p = expRep(((1.0 / temp[c]) - (1.0 / temp[c + 1])) * (funcval[c] - funcval[c + 1]));
+          pp = randomNumber();
+          if (pp < p) {
+            for (i = 0; i < nvars; i++) {
+              tmp = x[c][i];
+              x[c][i] = x[c + 1][i];
+              x[c + 1][i] = tmp;
+            }
+            tmp = funcval[c];
+            funcval[c] = funcval[c + 1];
+            funcval[c + 1] = tmp;
+            nswap++;
+          }
+        }
+      }
+
+      //Adjust vm so that approximately half of all evaluations are accepted
+      for (c = 0; c < nchains; c++) {
+        for (i = 0; i < nvars; i++) {
+          ratio = nsdiv * nacp[c][i];
+          nacp[c][i] = 0;
+          if (ratio > uratio) {
+            vm[c][i] = vm[c][i] * (1.0 + cs * (ratio - uratio));
+          } else if (ratio < lratio) {
+            vm[c][i] = vm[c][i] / (1.0 + cs * (lratio - ratio));
+          }
+
+          if (vm[c][i] < rathersmall)
+            vm[c][i] = rathersmall;
+          if (vm[c][i] > (upperb[i] - lowerb[i]))
+            vm[c][i] = upperb[i] - lowerb[i];
+        }
+      }
+    }
+
+    //Check termination criteria, using the coldest chain
+    for (i = tempcheck - 1; i > 0; i--)
+      fstar[i] = fstar[i - 1];
+    fstar[0] = funcval[0];
+
+    quit = 0;
+    if (fabs(fopt - funcval[0]) < ptsimanneps) {
+      quit = 1;
+      for (i = 0; i < tempcheck - 1; i++)
+        if (fabs(fstar[i + 1] - fstar[i]) > ptsimanneps)
+          quit = 0;
+    }
+
+    handle.logMessage(LOGINFO, "Checking convergence criteria after", iters, "function evaluations ...");
+
+    //Terminate the algorithm if appropriate
+    if (quit) {
+      handle.logMessage(LOGINFO, "\nStopping Parallel Tempering Simulated Annealing optimisation algorithm\n");
+      handle.logMessage(LOGINFO, "The optimisation stopped after", iters, "function evaluations");
+      handle.logMessage(LOGINFO, "The temperature was reduced to", temp[0]);
+      handle.logMessage(LOGINFO, "The optimisation stopped because an optimum was found for this run");
+      handle.logMessage(LOGINFO, "Number of directly accepted points", nacc);
+      handle.logMessage(LOGINFO, "Number of metropolis accepted points", naccmet);
+      handle.logMessage(LOGINFO, "Number of rejected points", nrej);
+      handle.logMessage(LOGINFO, "Number of exchanges between chains", nswap);
+
+      converge = 1;
+      score = EcoSystem->SimulateAndUpdate(bestx);
+      handle.logMessage(LOGINFO, "\nParallel Tempering Simulated Annealing finished with a likelihood score of", score);
+      return;
+    }
+
+    //If termination criteria is not met, prepare for another loop.
+    for (c = 0; c < nchains; c++) {
+      temp[c] *= rt;
+      if (temp[c] < rathersmall)
+        temp[c] = rathersmall;  //JMB make sure temperature doesnt get too small
+    }
+
+    handle.logMessage(LOGINFO, "Reducing the temperature to", temp[0]);
+    //the coldest chain restarts from the best point found by any of the chains
+    funcval[0] = fopt;
+    for (i = 0; i < nvars; i++)
+      x[0][i] = bestx[i];
+  }
+}
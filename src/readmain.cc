@@ -305,13 +305,15 @@ void Ecosystem::readOptimisation(CommentStream& infile) {
     }
 
     if (strcasecmp(text, "[hooke]") == 0)
-      optvec.resize(new OptInfoHooke());
+      optvec.resize(new OptInfoHooke(this));
     else if (strcasecmp(text, "[simann]") == 0)
-      optvec.resize(new OptInfoSimann());
+      optvec.resize(new OptInfoSimann(this));
+    else if (strcasecmp(text, "[ptsimann]") == 0)
+      optvec.resize(new OptInfoPTSimann(this));
     else if (strcasecmp(text, "[bfgs]") == 0)
-      optvec.resize(new OptInfoBFGS());
+      optvec.resize(new OptInfoBFGS(this));
     else
-      handle.logFileUnexpected(LOGFAIL, "[hooke], [simann], or [bfgs]", text);
+      handle.logFileUnexpected(LOGFAIL, "[hooke], [simann], [ptsimann] or [bfgs]", text);
 
     if (!infile.eof()) {
       infile >> text;
@@ -324,7 +326,7 @@ void Ecosystem::readOptimisation(CommentStream& infile) {
   delete[] text;
   if (count == 0) {
     handle.logFileMessage(LOGWARN, "no optimisation algorithms found, using default values");
-    optvec.resize(new OptInfoHooke());
+    optvec.resize(new OptInfoHooke(this));
   }
 }
 
@@ -371,7 +373,7 @@ void Ecosystem::readMain(CommentStream& infile, const MainInfo& main) {
   infile >> text >> ws;
   while ((strcasecmp(text, "[stock]") != 0) && !infile.eof()) {
     //Do not try to read printfile if we dont need it
-    if (main.runPrint()) {
+    if ((main.runPrint()) && (!isworker)) {
       subfile.open(text, ios::in);
       handle.checkIfFailure(subfile, text);
       handle.Open(text);
@@ -3,6 +3,7 @@
 #include "readfunc.h"
 #include "keeper.h"
 #include "readword.h"
+#include "mathfunc.h"
 #include "gadget.h"
 #include "global.h"
 
@@ -18,6 +19,7 @@ RenewalData::RenewalData(CommentStream& infile, const IntVector& Areas,
   strncpy(text, "", MaxStrLength);
 
   index = 0;
+  parchanged = 1;
   int i, j;
   double minlength, maxlength, dl;
   readWordAndVariable(infile, "minlength", minlength);
@@ -164,10 +166,12 @@ void RenewalData::readNormalParameterData(CommentStream& infile, Keeper* const k
       infile >> beta[count] >> ws;
 
       renewalMult[count].Inform(keeper);
+      keeper->setDependency(&parchanged);
       meanLength[count].Inform(keeper);
       sdevLength[count].Inform(keeper);
       alpha[count].Inform(keeper);
       beta[count].Inform(keeper);
+      keeper->clearDependency();
       count++;
 
     } else { //renewal data not required - skip rest of line
@@ -235,9 +239,11 @@ void RenewalData::readNormalConditionData(CommentStream& infile, Keeper* const k
       infile >> relCond[count] >> ws;
 
       renewalMult[count].Inform(keeper);
+      keeper->setDependency(&parchanged);
       meanLength[count].Inform(keeper);
       sdevLength[count].Inform(keeper);
       relCond[count].Inform(keeper);
+      keeper->clearDependency();
       count++;
 
     } else { //renewal data not required - skip rest of line
@@ -343,8 +349,10 @@ void RenewalData::readNumberData(CommentStream& infile, Keeper* const keeper,
     }
   }
 
+  keeper->setDependency(&parchanged);
   for (i = 0; i < renewalNumber.Size(); i++)
     (*renewalNumber[i]).Inform(keeper);
+  keeper->clearDependency();
 
   if (count == 0)
     handle.logMessage(LOGWARN, "Warning in renewal - found no data in the data file");
@@ -396,11 +404,36 @@ void RenewalData::Print(ofstream& outfile) const {
   outfile.flush();
 }
 
+double RenewalData::calcNormalDistribution(PopInfoIndexVector& pop, double mean, double mult) {
+  int l, minl = pop.minCol(), numlen = pop.Size();
+  double dnorm, sum = 0.0;
+
+  if (numlen <= 0)
+    return 0.0;
+  if (normdist.Size() < numlen)
+    normdist.resize(numlen - normdist.Size(), 0.0);
+  for (l = 0; l < numlen; l++) {
+    dnorm = (LgrpDiv->meanLength(l + minl) - mean) * mult;
+    normdist[l] = -(dnorm * dnorm) * 0.5;
+  }
+  calcExpVector(&normdist[0], &normdist[0], numlen);
+  for (l = 0; l < numlen; l++) {
+    pop[l + minl].N = normdist[l];
+    sum += normdist[l];
+  }
+  return sum;
+}
+
 void RenewalData::Reset() {
   int i, age, l, minage;
-  double sum, mult, dnorm;
+  double sum, mult;
 
   index = 0;
+  //the distributions from the last model run can be used if the parameters havent changed
+  if (!parchanged)
+    return;
+  parchanged = 0;
+
   if (readoption == 0) {
     for (i = 0; i < renewalTime.Size(); i++) {
       age = renewalAge[i];
@@ -421,13 +454,8 @@ void RenewalData::Reset() {
         if (meanLength[i] > LgrpDiv->maxLength())
           handle.logMessage(LOGWARN, "Warning in renewal - mean length is greater than maximum length for stock", this->getName());
 
-        sum = 0.0;
         mult = 1.0 / sdevLength[i];
-        for (l = renewalDistribution[i].minLength(age); l < renewalDistribution[i].maxLength(age); l++) {
-          dnorm = (LgrpDiv->meanLength(l) - meanLength[i]) * mult;
-          renewalDistribution[i][age][l].N = exp(-(dnorm * dnorm) * 0.5);
-          sum += renewalDistribution[i][age][l].N;
-        }
+        sum = this->calcNormalDistribution(renewalDistribution[i][age], meanLength[i], mult);
 
         if (isZero(sum)) {
           handle.logMessage(LOGWARN, "Warning in renewal - calculated zero recruits for stock", this->getName());
@@ -466,13 +494,8 @@ void RenewalData::Reset() {
         if (meanLength[i] > LgrpDiv->maxLength())
           handle.logMessage(LOGWARN, "Warning in renewal - mean length is greater than maximum length for stock", this->getName());
 
-        sum = 0.0;
         mult = 1.0 / sdevLength[i];
-        for (l = renewalDistribution[i].minLength(age); l < renewalDistribution[i].maxLength(age); l++) {
-          dnorm = (LgrpDiv->meanLength(l) - meanLength[i]) * mult;
-          renewalDistribution[i][age][l].N = exp(-(dnorm * dnorm) * 0.5);
-          sum += renewalDistribution[i][age][l].N;
-        }
+        sum = this->calcNormalDistribution(renewalDistribution[i][age], meanLength[i], mult);
 
         if (isZero(sum)) {
           handle.logMessage(LOGWARN, "Warning in renewal - calculated zero recruits for stock", this->getName());
@@ -178,8 +178,6 @@
 #include "ecosystem.h"
 #include "global.h"
 
-extern Ecosystem* EcoSystem;
-
 
 void OptInfoSimann::OptimiseLikelihood() {
 
@@ -194,6 +192,9 @@ void OptInfoSimann::OptimiseLikelihood() {
   int    rchange, rcheck, rnumber;  //Used to randomise the order of the parameters
 
   handle.logMessage(LOGINFO, "\nStarting Simulated Annealing optimisation algorithm\n");
+  //each point depends on the result for the previous point, so they cant be evaluated in batches
+  if (EcoSystem->getNumForks() > 0)
+    handle.logMessage(LOGWARN, "Warning - Simulated Annealing evaluates one point at a time, so the worker processes will not be used");
   int nvars = EcoSystem->numOptVariables();
   DoubleVector x(nvars);
   DoubleVector init(nvars);
@@ -297,7 +298,10 @@ void OptInfoSimann::OptimiseLikelihood() {
           }
 
           //Evaluate the function with the trial point trialx and return as -trialf
-          trialf = EcoSystem->SimulateAndUpdate(trialx);
+          //The smallest non-zero random number is 1/32767, so a point that is worse than
+          //funcval by more than 11*t can only be accepted if the random number is zero,
+          //and the model run can be stopped once the point is known to be that bad
+          trialf = EcoSystem->SimulateAndUpdate(trialx, (11.0 * t) - funcval);
           trialf = -trialf;
 
           //If too many function evaluations occur, terminate the algorithm
@@ -330,7 +334,9 @@ void OptInfoSimann::OptimiseLikelihood() {
             p = expRep((trialf - funcval) / t);
             pp = randomNumber();
             if (pp < p) {
-              //Accept point
+              //Accept point, which needs the full likelihood score if the model run was stopped early
+              if (EcoSystem->isStoppedEarly())
+                trialf = -EcoSystem->finishSimulation();
               for (i = 0; i < nvars; i++)
                 x[i] = trialx[i];
               funcval = trialf;
@@ -6,116 +6,286 @@
 
 void Ecosystem::updatePredationOneArea(int area) {
   int i;
+  double t;
   // calculate the number of preys and predators in area.
   for (i = 0; i < basevec.Size(); i++)
-    if (basevec[i]->isInArea(area))
+    if (basevec[i]->isInArea(area)) {
+      t = profile.startTimer();
       basevec[i]->calcNumbers(area, TimeInfo);
+      profile.stopTimer(profbase + i, t);
+    }
   for (i = 0; i < basevec.Size(); i++)
-    if (basevec[i]->isInArea(area))
+    if (basevec[i]->isInArea(area)) {
+      t = profile.startTimer();
       basevec[i]->calcEat(area, Area, TimeInfo);
+      profile.stopTimer(profbase + i, t);
+    }
   for (i = 0; i < basevec.Size(); i++)
-    if (basevec[i]->isInArea(area))
+    if (basevec[i]->isInArea(area)) {
+      t = profile.startTimer();
       basevec[i]->checkEat(area, TimeInfo);
+      profile.stopTimer(profbase + i, t);
+    }
   for (i = 0; i < basevec.Size(); i++)
-    if (basevec[i]->isInArea(area))
+    if (basevec[i]->isInArea(area)) {
+      t = profile.startTimer();
       basevec[i]->adjustEat(area, TimeInfo);
+      profile.stopTimer(profbase + i, t);
+    }
   for (i = 0; i < basevec.Size(); i++)
-    if (basevec[i]->isInArea(area))
+    if (basevec[i]->isInArea(area)) {
+      t = profile.startTimer();
       basevec[i]->reducePop(area, TimeInfo);
+      profile.stopTimer(profbase + i, t);
+    }
 }
 
 void Ecosystem::updatePopulationOneArea(int area) {
   int i;
-  // under updates are movements to mature stock, renewal, spawning and straying.
-  for (i = 0; i < basevec.Size(); i++)
-    if (basevec[i]->isInArea(area))
-      basevec[i]->Grow(area, Area, TimeInfo);
-  for (i = 0; i < basevec.Size(); i++)
-    if (basevec[i]->isInArea(area))
-      basevec[i]->updatePopulationPart1(area, TimeInfo);
-  for (i = 0; i < basevec.Size(); i++)
-    if (basevec[i]->isInArea(area))
-      basevec[i]->updatePopulationPart2(area, TimeInfo);
-  for (i = 0; i < basevec.Size(); i++)
-    if (basevec[i]->isInArea(area))
-      basevec[i]->updatePopulationPart3(area, TimeInfo);
-  for (i = 0; i < basevec.Size(); i++)
-    if (basevec[i]->isInArea(area))
-      basevec[i]->updatePopulationPart4(area, TimeInfo);
-  for (i = 0; i < basevec.Size(); i++)
-    if (basevec[i]->isInArea(area))
-      basevec[i]->updatePopulationPart5(area, TimeInfo);
+  // the groups of stocks dont share any fish so they can be updated at the same time
+  if ((stockgroups.Nrow() > 1) && (handle.getLogLevel() < LOGMESSAGE)) {
+    stockarea = area;
+    simpool.Run(Ecosystem::runPopulationGroup, this, stockgroups.Nrow());
+  } else
+    for (i = 0; i < stockgroups.Nrow(); i++)
+      this->updatePopulationGroup(area, i);
 }
 
 void Ecosystem::updateAgesOneArea(int area) {
   int i;
+  if ((stockgroups.Nrow() > 1) && (handle.getLogLevel() < LOGMESSAGE)) {
+    stockarea = area;
+    simpool.Run(Ecosystem::runAgesGroup, this, stockgroups.Nrow());
+  } else
+    for (i = 0; i < stockgroups.Nrow(); i++)
+      this->updateAgesGroup(area, i);
+}
+
+void Ecosystem::updatePopulationGroup(int area, int group) {
+  int i, j;
+  double t;
+  // under updates are movements to mature stock, renewal, spawning and straying.
+  for (i = 0; i < stockgroups.Ncol(group); i++) {
+    j = stockgroups[group][i];
+    if (basevec[j]->isInArea(area)) {
+      t = profile.startTimer();
+      basevec[j]->Grow(area, Area, TimeInfo);
+      profile.stopTimer(profbase + j, t);
+    }
+  }
+  for (i = 0; i < stockgroups.Ncol(group); i++) {
+    j = stockgroups[group][i];
+    if (basevec[j]->isInArea(area)) {
+      t = profile.startTimer();
+      basevec[j]->updatePopulationPart1(area, TimeInfo);
+      profile.stopTimer(profbase + j, t);
+    }
+  }
+  for (i = 0; i < stockgroups.Ncol(group); i++) {
+    j = stockgroups[group][i];
+    if (basevec[j]->isInArea(area)) {
+      t = profile.startTimer();
+      basevec[j]->updatePopulationPart2(area, TimeInfo);
+      profile.stopTimer(profbase + j, t);
+    }
+  }
+  for (i = 0; i < stockgroups.Ncol(group); i++) {
+    j = stockgroups[group][i];
+    if (basevec[j]->isInArea(area)) {
+      t = profile.startTimer();
+      basevec[j]->updatePopulationPart3(area, TimeInfo);
+      profile.stopTimer(profbase + j, t);
+    }
+  }
+  for (i = 0; i < stockgroups.Ncol(group); i++) {
+    j = stockgroups[group][i];
+    if (basevec[j]->isInArea(area)) {
+      t = profile.startTimer();
+      basevec[j]->updatePopulationPart4(area, TimeInfo);
+      profile.stopTimer(profbase + j, t);
+    }
+  }
+  for (i = 0; i < stockgroups.Ncol(group); i++) {
+    j = stockgroups[group][i];
+    if (basevec[j]->isInArea(area)) {
+      t = profile.startTimer();
+      basevec[j]->updatePopulationPart5(area, TimeInfo);
+      profile.stopTimer(profbase + j, t);
+    }
+  }
+}
+
+void Ecosystem::updateAgesGroup(int area, int group) {
+  int i, j;
+  double t;
   // age related update and movements between stocks.
-  for (i = 0; i < basevec.Size(); i++)
-    if (basevec[i]->isInArea(area))
-      basevec[i]->updateAgePart1(area, TimeInfo);
-  for (i = 0; i < basevec.Size(); i++)
-    if (basevec[i]->isInArea(area))
-      basevec[i]->updateAgePart2(area, TimeInfo);
-  for (i = 0; i < basevec.Size(); i++)
-    if (basevec[i]->isInArea(area))
-      basevec[i]->updateAgePart3(area, TimeInfo);
+  for (i = 0; i < stockgroups.Ncol(group); i++) {
+    j = stockgroups[group][i];
+    if (basevec[j]->isInArea(area)) {
+      t = profile.startTimer();
+      basevec[j]->updateAgePart1(area, TimeInfo);
+      profile.stopTimer(profbase + j, t);
+    }
+  }
+  for (i = 0; i < stockgroups.Ncol(group); i++) {
+    j = stockgroups[group][i];
+    if (basevec[j]->isInArea(area)) {
+      t = profile.startTimer();
+      basevec[j]->updateAgePart2(area, TimeInfo);
+      profile.stopTimer(profbase + j, t);
+    }
+  }
+  for (i = 0; i < stockgroups.Ncol(group); i++) {
+    j = stockgroups[group][i];
+    if (basevec[j]->isInArea(area)) {
+      t = profile.startTimer();
+      basevec[j]->updateAgePart3(area, TimeInfo);
+      profile.stopTimer(profbase + j, t);
+    }
+  }
+}
+
+void Ecosystem::runPopulationGroup(void* eco, int group) {
+  Ecosystem* e = (Ecosystem*)eco;
+  e->updatePopulationGroup(e->stockarea, group);
+}
+
+void Ecosystem::runAgesGroup(void* eco, int group) {
+  Ecosystem* e = (Ecosystem*)eco;
+  e->updateAgesGroup(e->stockarea, group);
+}
+
+void Ecosystem::runPredationArea(void* eco, int area) {
+  ((Ecosystem*)eco)->updatePredationOneArea(area);
+}
+
+void Ecosystem::runLikelihood(void* eco, int comp) {
+  Ecosystem* e = (Ecosystem*)eco;
+  double t = e->profile.startTimer();
+  e->likevec[comp]->addLikelihood(e->TimeInfo);
+  e->profile.stopTimer(e->proflike + comp, t);
+}
+
+int Ecosystem::isOverCutoff() const {
+  int i;
+  double score;
+  if (!usecutoff)
+    return 0;
+
+  //the components are added in the same order as the final likelihood score
+  score = 0.0;
+  for (i = 0; i < likevec.Size(); i++)
+    score += likevec[i]->getLikelihood();
+  return (score > simcutoff);
 }
 
 void Ecosystem::Simulate(int print) {
   int i, j, k;
+  double tsim, t, tpart;
 
-  handle.logMessage(LOGMESSAGE, "");  //write blank line to log file
+  tsim = profile.startTimer();
+  if (!isworker)
+    handle.logMessage(LOGMESSAGE, "");  //write blank line to log file
+  if (checkcapture)
+    this->startTrace();
+  tpart = profile.startTimer();
   for (j = 0; j < likevec.Size(); j++)
     likevec[j]->Reset(keeper);
   for (j = 0; j < likevec.Size(); j++)
     likevec[j]->addLikelihoodKeeper(TimeInfo, keeper);
+  profile.stopTimer(PROFRESET, tpart);
 
   for (j = 0; j < tagvec.Size(); j++)
     tagvec[j]->Reset();
 
   TimeInfo->Reset();
-  for (i = 0; i < TimeInfo->numTotalSteps(); i++) {
-    for (j = 0; j < basevec.Size(); j++)
+  simstopped = this->isOverCutoff();
+  for (i = 0; (i < TimeInfo->numTotalSteps()) && (!simstopped); i++) {
+    // record when the parameters are used, and take any snapshots of the model
+    if (checkcapture)
+      this->checkpointStep(i + 1);
+
+    tpart = profile.startTimer();
+    for (j = 0; j < basevec.Size(); j++) {
+      t = profile.startTimer();
       basevec[j]->Reset(TimeInfo);
+      profile.stopTimer(profbase + j, t);
+    }
 
     // add in any new tagging experiments
     tagvec.updateTags(TimeInfo);
     for (j = 0; j < likevec.Size(); j++)  //only proglikelihood
       likevec[j]->Reset(TimeInfo);
+    profile.stopTimer(PROFRESET, tpart);
 
-    if (print)
+    if (print) {
+      tpart = profile.startTimer();
       for (j = 0; j < printvec.Size(); j++)
         printvec[j]->Print(TimeInfo, 1);  //start of timestep, so printtime is 1
+      profile.stopTimer(PROFPRINT, tpart);
+    }
 
     // migration between areas
-    if (Area->numAreas() > 1)    //no migration if there is only one area
-      for (j = 0; j < basevec.Size(); j++)
+    if (Area->numAreas() > 1) {   //no migration if there is only one area
+      tpart = profile.startTimer();
+      for (j = 0; j < basevec.Size(); j++) {
+        t = profile.startTimer();
         basevec[j]->Migrate(TimeInfo);
+        profile.stopTimer(profbase + j, t);
+      }
+      profile.stopTimer(PROFMIGRATE, tpart);
+    }
 
-    // predation can be split into substeps
+    // predation can be split into substeps, and the areas can be calculated at the same time
     for (k = 0; k < TimeInfo->numSubSteps(); k++) {
-      for (j = 0; j < Area->numAreas(); j++)
-        this->updatePredationOneArea(j);
+      tpart = profile.startTimer();
+      if ((areaconcurrent) && (handle.getLogLevel() < LOGMESSAGE))
+        simpool.Run(Ecosystem::runPredationArea, this, Area->numAreas());
+      else
+        for (j = 0; j < Area->numAreas(); j++)
+          this->updatePredationOneArea(j);
       TimeInfo->IncrementSubstep();
+      profile.stopTimer(PROFPREDATION + k, tpart);
     }
 
     // maturation, spawning, recruits etc
+    tpart = profile.startTimer();
     for (j = 0; j < Area->numAreas(); j++)
       this->updatePopulationOneArea(j);
+    profile.stopTimer(PROFPOPULATION, tpart);
 
-    for (j = 0; j < likevec.Size(); j++)
-      likevec[j]->addLikelihood(TimeInfo);
+    // the likelihood components are only calculated at the same time if the log messages dont need to be kept in order
+    tpart = profile.startTimer();
+    if ((likeconcurrent) && (handle.getLogLevel() < LOGMESSAGE))
+      simpool.Run(Ecosystem::runLikelihood, this, likevec.Size());
+    else
+      for (j = 0; j < likevec.Size(); j++)
+        Ecosystem::runLikelihood(this, j);
+    profile.stopTimer(PROFLIKELIHOOD, tpart);
 
-    if (print)
+    // stop the simulation if the likelihood score is already worse than the cutoff
+    if (this->isOverCutoff()) {
+      simstopped = 1;
+      if (handle.getLogLevel() >= LOGMESSAGE)
+        handle.logMessage(LOGMESSAGE, "\nStopping the simulation early, since the likelihood score is worse than", simcutoff);
+      break;
+    }
+
+    if (print) {
+      tpart = profile.startTimer();
       for (j = 0; j < printvec.Size(); j++)
         printvec[j]->Print(TimeInfo, 0);  //end of timestep, so printtime is 0
+      profile.stopTimer(PROFPRINT, tpart);
+    }
 
+    tpart = profile.startTimer();
     for (j = 0; j < Area->numAreas(); j++)
       this->updateAgesOneArea(j);
+    profile.stopTimer(PROFAGE, tpart);
 
 #ifdef INTERRUPT_HANDLER
     if (interrupted) {
-      InterruptInterface ui;
+      InterruptInterface ui(this);
       if (!ui.menu()) {
         handle.logMessage(LOGMESSAGE, "\n** Gadget interrupted - quitting current simulation **");
         char interruptfile[15];
@@ -138,12 +308,20 @@ void Ecosystem::Simulate(int print) {
 
   // remove all the tagging experiments - they must have expired now
   tagvec.deleteAllTags();
+  if (checkcapture)
+    this->stopTrace();
 
   likelihood = 0.0;
   for (j = 0; j < likevec.Size(); j++)
     likelihood += likevec[j]->getLikelihood();
+  profile.stopTimer(PROFSIMULATE, tsim);
+  profile.countRun();
+
+  // a simulation resumed from a snapshot sends the likelihood score back to the model
+  if (checkreply >= 0)
+    this->finishResume();
 
-  if (handle.getLogLevel() >= LOGMESSAGE) {
+  if ((handle.getLogLevel() >= LOGMESSAGE) && (!isworker)) {
     handle.logMessage(LOGMESSAGE, "\nThe current likelihood scores for each component are:");
     for (j = 0; j < likevec.Size(); j++)
       handle.logMessage(LOGMESSAGE, likevec[j]->getName(), likevec[j]->getLikelihood());
@@ -357,6 +357,10 @@ int SpawnData::isSpawnStepArea(int area, const TimeClass* const TimeInfo) {
   return 0;
 }
 
+const StockPtrVector& SpawnData::getSpawnStocks() {
+  return spawnStocks;
+}
+
 void SpawnData::Reset(const TimeClass* const TimeInfo) {
   int i;
 
@@ -134,6 +134,7 @@ Stock::Stock(CommentStream& infile, const char* givenname,
   if (strcasecmp(text, "naturalmortality") != 0)
     handle.logFileUnexpected(LOGFAIL, "naturalmortality", text);
   naturalm = new NaturalMortality(infile, minage, numage, this->getName(), areas, TimeInfo, keeper);
+  propsurviving.AddRows(areas.Size(), numage, 0.0);
   handle.logMessage(LOGMESSAGE, "Read natural mortality data for stock", this->getName());
 
   //read the prey data
@@ -506,6 +507,12 @@ const StockPtrVector& Stock::getStrayStocks() {
   return stray->getStrayStocks();
 }
 
+const StockPtrVector& Stock::getSpawnStocks() {
+  if (!doesspawn)
+    handle.logMessage(LOGFAIL, "Error in stock - no spawned stocks defined for", this->getName());
+  return spawner->getSpawnStocks();
+}
+
 AgeBandMatrix& Stock::getConsumptionALK(int area) {
 //  if (!iseaten)
 //    handle.logMessage(LOGWARN, "Error in stock - no prey for", this->getName());
@@ -10,7 +10,7 @@ StockAggregator::StockAggregator(const StockPtrVector& Stocks,
   const LengthGroupDivision* const LgrpDiv, const IntMatrix& Areas, const IntMatrix& Ages)
   : stocks(Stocks), areas(Areas), ages(Ages), alptr(0) {
 
-  int i;
+  int area, age, i, j, k;
   for (i = 0; i < stocks.Size(); i++) {
     CI.resize(new ConversionIndex(stocks[i]->getLengthGroupDiv(), LgrpDiv));
     if (CI[i]->Error())
@@ -23,6 +23,24 @@ StockAggregator::StockAggregator(const StockPtrVector& Stocks,
   PopInfoMatrix popmatrix(ages.Nrow(), LgrpDiv->numLengthGroups(), tmppop);
   total.resize(areas.Nrow(), 0, 0, popmatrix);
   this->Reset();
+
+  //the structure of the aggregation doesn't change, so find the entries to be added now
+  plan.addGroup();
+  for (i = 0; i < stocks.Size(); i++) {
+    for (area = 0; area < areas.Nrow(); area++) {
+      for (j = 0; j < areas.Ncol(area); j++) {
+        if (stocks[i]->isInArea(areas[area][j])) {
+          alptr = &stocks[i]->getCurrentALK(areas[area][j]);
+          for (age = 0; age < ages.Nrow(); age++) {
+            for (k = 0; k < ages.Ncol(age); k++) {
+              if ((alptr->minAge() <= ages[age][k]) && (ages[age][k] <= alptr->maxAge()))
+                plan.addEntries(total[area][age], (*alptr)[ages[age][k]], *CI[i]);
+            }
+          }
+        }
+      }
+    }
+  }
 }
 
 StockAggregator::~StockAggregator() {
@@ -50,23 +68,7 @@ void StockAggregator::Reset() {
 }
 
 void StockAggregator::Sum() {
-  int area, age, i, j, k;
-
   this->Reset();
   //Sum over the appropriate stocks, areas, ages and length groups.
-  for (i = 0; i < stocks.Size(); i++) {
-    for (area = 0; area < areas.Nrow(); area++) {
-      for (j = 0; j < areas.Ncol(area); j++) {
-        if (stocks[i]->isInArea(areas[area][j])) {
-          alptr = &stocks[i]->getCurrentALK(areas[area][j]);
-          for (age = 0; age < ages.Nrow(); age++) {
-            for (k = 0; k < ages.Ncol(age); k++) {
-              if ((alptr->minAge() <= ages[age][k]) && (ages[age][k] <= alptr->maxAge()))
-                total[area][age].Add((*alptr)[ages[age][k]], *CI[i]);
-            }
-          }
-        }
-      }
-    }
-  }
+  plan.Sum(0, 1.0);
 }
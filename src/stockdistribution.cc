@@ -183,6 +183,28 @@ StockDistribution::StockDistribution(CommentStream& infile,
       handle.logMessage(LOGWARN, "Warning in stockdistribution - unrecognised function", functionname);
       break;
   }
+
+  if (functionnumber == 1)
+    this->calcDataTerms(numarea, numage, numlen);
+}
+
+void StockDistribution::calcDataTerms(int numarea, int numage, int numlen) {
+  int i, area, s, id;
+  int numstock = stocknames.Size();
+
+  //the observed data doesn't change, so the terms that only depend on it are calculated once
+  obsdata.resize(numstock, 0.0);
+  moddata.resize(numstock, 0.0);
+  dataterms.AddRows(obsDistribution.Nrow(), numarea * numage * numlen, 0.0);
+  for (i = 0; i < obsDistribution.Nrow(); i++) {
+    for (area = 0; area < numarea; area++) {
+      for (id = 0; id < (numage * numlen); id++) {
+        for (s = 0; s < numstock; s++)
+          obsdata[s] = (*obsDistribution[i][area])[s][id];
+        dataterms[i][area * numage * numlen + id] = MN.calcDataTerm(obsdata);
+      }
+    }
+  }
 }
 
 void StockDistribution::readStockData(CommentStream& infile,
@@ -526,8 +548,6 @@ double StockDistribution::calcLikMultinomial() {
   int numage = ages.Nrow();
   int numlen = LgrpDiv->numLengthGroups();
   int numstock = stocknames.Size();
-  DoubleVector obsdata(numstock, 0.0);
-  DoubleVector moddata(numstock, 0.0);
 
   MN.Reset();
   //the object MN does most of the work, accumulating likelihood
@@ -545,7 +565,8 @@ double StockDistribution::calcLikMultinomial() {
         obsdata[s] = (*obsDistribution[timeindex][area])[s][i];
         moddata[s] = (*modelDistribution[timeindex][area])[s][i];
       }
-      likelihoodValues[timeindex][area] += MN.calcLogLikelihood(obsdata, moddata);
+      likelihoodValues[timeindex][area] += MN.calcLogLikelihood(obsdata, moddata,
+        dataterms[timeindex][area * numage * numlen + i]);
     }
   }
   return MN.getLogLikelihood();
@@ -72,16 +72,14 @@ void Stock::reducePop(int area, const TimeClass* const TimeInfo) {
     Alkeys[inarea].Multiply(naturalm->getProportion(area));
   } else {
     //changed to include the possibility of substeps
-    DoubleVector* PropSurviving;
-    PropSurviving = new DoubleVector(naturalm->getProportion(area));
+    const DoubleVector& proportion = naturalm->getProportion(area);
     double timeratio = 1.0 / TimeInfo->numSubSteps();
 
     int i;
-    for (i = 0; i < PropSurviving->Size(); i++)
-      (*PropSurviving)[i] = pow((*PropSurviving)[i], timeratio);
+    for (i = 0; i < proportion.Size(); i++)
+      propsurviving[inarea][i] = pow(proportion[i], timeratio);
 
-    Alkeys[inarea].Multiply(*PropSurviving);
-    delete PropSurviving;
+    Alkeys[inarea].Multiply(propsurviving[inarea]);
   }
 
   if (istagged && tagAlkeys.numTagExperiments() > 0)
@@ -85,11 +85,22 @@ StockPredator::StockPredator(CommentStream& infile, const char* givenname, const
   Phi.AddRows(numarea, numlength, 0.0);
   fphi.AddRows(numarea, numlength, 0.0);
   subfphi.AddRows(numarea, numlength, 0.0);
+  preyenergy.AddRows(numarea, 0, 0.0);
+  suitcalc.resize(numarea, -1);
+  for (i = 0; i < numarea; i++)
+    suitenergy.resize();
 
   keeper->clearLast();
   keeper->clearLast();
 }
 
+StockPredator::~StockPredator() {
+  int i, j;
+  for (i = 0; i < suitenergy.Nrow(); i++)
+    for (j = 0; j < suitenergy[i].Size(); j++)
+      delete suitenergy[i][j];
+}
+
 void StockPredator::Print(ofstream& outfile) const {
   int i, area;
   outfile << "\nStock predator\n";
@@ -145,7 +156,7 @@ void StockPredator::Eat(int area, const AreaClass* const Area, const TimeClass*
 
   int prey, predl, preyl, check;
   int inarea = this->areaNum(area);
-  double tmp;
+  double tmp, phi;
 
   if (TimeInfo->getSubStep() == 1) {
     //this is the first substep of the timestep so need to reset things
@@ -159,7 +170,10 @@ void StockPredator::Eat(int area, const AreaClass* const Area, const TimeClass*
       tmp = exp(temperature * (consParam[1] - temperature * temperature * consParam[2]))
            * consParam[0] * TimeInfo->getTimeStepLength() / TimeInfo->numSubSteps();
       for (predl = 0; predl < LgrpDiv->numLengthGroups(); predl++)
-        maxcons[inarea][predl] = tmp * pow(LgrpDiv->meanLength(predl), consParam[3]);
+        maxcons[inarea][predl] = LgrpDiv->meanLength(predl);
+      calcPowVector(&maxcons[inarea][0], &maxcons[inarea][0], consParam[3], LgrpDiv->numLengthGroups());
+      for (predl = 0; predl < LgrpDiv->numLengthGroups(); predl++)
+        maxcons[inarea][predl] *= tmp;
 
     } else if (functionnumber == 2) {
       double max1, max2, max3, l;
@@ -184,23 +198,33 @@ void StockPredator::Eat(int area, const AreaClass* const Area, const TimeClass*
 
   //Now maxcons contains the maximum consumption by length
   //Calculating Phi(L) and O(l,L,prey) based on energy requirements
+  this->calcSuitEnergy(inarea);
   for (prey = 0; prey < this->numPreys(); prey++) {
     check = 0;
     if (isEqual(preference[prey], 1.0))
       check = 1;
 
     if ((this->getPrey(prey)->isPreyArea(area)) && (!(isZero(this->getPrey(prey)->getEnergy())))) {
+      const DoubleVector& biomass = this->getPrey(prey)->getBiomass(area);
       for (predl = 0; predl < LgrpDiv->numLengthGroups(); predl++) {
-        for (preyl = 0; preyl < (*cons[inarea][prey])[predl].Size(); preyl++) {
-          tmp = this->getSuitability(prey)[predl][preyl] * this->getPrey(prey)->getEnergy()
-                  * this->getPrey(prey)->getBiomass(area, preyl);
-
+        const DoubleVector& suit = (*suitenergy[inarea][prey])[predl];
+        DoubleVector& preycons = (*cons[inarea][prey])[predl];
+        phi = Phi[inarea][predl];
+        if (check) {
+          for (preyl = 0; preyl < preycons.Size(); preyl++) {
+            tmp = suit[preyl] * biomass[preyl];
+            preycons[preyl] = tmp;
+            phi += tmp;
+          }
+        } else {
           //JMB - dont take the power if we dont have to
-          if (!check)
-            tmp = pow(tmp, preference[prey]);
-          (*cons[inarea][prey])[predl][preyl] = tmp;
-          Phi[inarea][predl] += tmp;
+          for (preyl = 0; preyl < preycons.Size(); preyl++)
+            preycons[preyl] = suit[preyl] * biomass[preyl];
+          calcPowVector(&preycons[0], &preycons[0], preference[prey], preycons.Size());
+          for (preyl = 0; preyl < preycons.Size(); preyl++)
+            phi += preycons[preyl];
         }
+        Phi[inarea][predl] = phi;
       }
 
     } else {
@@ -256,6 +280,36 @@ void StockPredator::Eat(int area, const AreaClass* const Area, const TimeClass*
         this->getPrey(prey)->addBiomassConsumption(area, (*cons[inarea][prey])[predl]);
 }
 
+void StockPredator::calcSuitEnergy(int inarea) {
+  int prey, predl, preyl, check;
+
+  //the suitability values and energy content dont usually change between the
+  //timesteps so the product is only recalculated when either has changed
+  check = (suitcalc[inarea] != this->numSuitabilityCalculated());
+  if (preyenergy[inarea].Size() != this->numPreys()) {
+    preyenergy[inarea].resize(this->numPreys() - preyenergy[inarea].Size(), 0.0);
+    check = 1;
+  }
+  for (prey = 0; prey < this->numPreys(); prey++)
+    if (preyenergy[inarea][prey] != this->getPrey(prey)->getEnergy())
+      check = 1;
+
+  if (!check)
+    return;
+
+  for (prey = 0; prey < this->numPreys(); prey++) {
+    const DoubleMatrix& suit = this->getSuitability(prey);
+    if (suitenergy[inarea].Size() <= prey)
+      suitenergy[inarea].resize(new DoubleMatrix(suit.Nrow(), suit.Ncol(), 0.0));
+
+    preyenergy[inarea][prey] = this->getPrey(prey)->getEnergy();
+    for (predl = 0; predl < suit.Nrow(); predl++)
+      for (preyl = 0; preyl < suit.Ncol(predl); preyl++)
+        (*suitenergy[inarea][prey])[predl][preyl] = suit[predl][preyl] * preyenergy[inarea][prey];
+  }
+  suitcalc[inarea] = this->numSuitabilityCalculated();
+}
+
 //Check if any of the preys of the predator are eaten up.
 //adjust the consumption according to that.
 void StockPredator::adjustConsumption(int area, const TimeClass* const TimeInfo) {
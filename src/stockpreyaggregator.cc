@@ -10,7 +10,7 @@ StockPreyAggregator::StockPreyAggregator(const PreyPtrVector& Preys,
   const LengthGroupDivision* const LgrpDiv, const IntMatrix& Areas, const IntMatrix& Ages)
   : preys(Preys), areas(Areas), ages(Ages), alptr(0) {
 
-  int i;
+  int area, age, i, j, k, numlen;
   for (i = 0; i < preys.Size(); i++) {
     CI.resize(new ConversionIndex(preys[i]->getLengthGroupDiv(), LgrpDiv));
     if (CI[i]->Error())
@@ -27,6 +27,29 @@ StockPreyAggregator::StockPreyAggregator(const PreyPtrVector& Preys,
   PopInfoMatrix popmatrix(ages.Nrow(), LgrpDiv->numLengthGroups(), tmppop);
   total.resize(areas.Nrow(), 0, 0, popmatrix);
   this->Reset();
+
+  //the structure of the aggregation doesn't change, so find the entries to be added now
+  //each prey and area is added as a separate group, since the ratio used can be different
+  //and the prey might not be available to be consumed on that area during the simulation
+  for (i = 0; i < preys.Size(); i++) {
+    for (area = 0; area < areas.Nrow(); area++) {
+      for (j = 0; j < areas.Ncol(area); j++) {
+        if (preys[i]->isInArea(areas[area][j])) {
+          plan.addGroup();
+          groupprey.resize(1, i);
+          grouparea.resize(1, areas[area][j]);
+          alptr = &((StockPrey*)preys[i])->getConsumptionALK(areas[area][j]);
+          numlen = preys[i]->getLengthGroupDiv()->numLengthGroups();
+          for (age = 0; age < ages.Nrow(); age++) {
+            for (k = 0; k < ages.Ncol(age); k++) {
+              if ((alptr->minAge() <= ages[age][k]) && (ages[age][k] <= alptr->maxAge()))
+                plan.addEntries(total[area][age], (*alptr)[ages[age][k]], *CI[i], numlen);
+            }
+          }
+        }
+      }
+    }
+  }
 }
 
 StockPreyAggregator::~StockPreyAggregator() {
@@ -54,23 +77,11 @@ void StockPreyAggregator::Reset() {
 }
 
 void StockPreyAggregator::Sum() {
-  int area, age, i, j, k;
+  int g;
 
   this->Reset();
   //Sum over the appropriate preys, areas, ages and length groups.
-  for (i = 0; i < preys.Size(); i++) {
-    for (area = 0; area < areas.Nrow(); area++) {
-      for (j = 0; j < areas.Ncol(area); j++) {
-        if (preys[i]->isPreyArea(areas[area][j])) {
-          alptr = &((StockPrey*)preys[i])->getConsumptionALK(areas[area][j]);
-          for (age = 0; age < ages.Nrow(); age++) {
-            for (k = 0; k < ages.Ncol(age); k++) {
-              if ((alptr->minAge() <= ages[age][k]) && (ages[age][k] <= alptr->maxAge()))
-                total[area][age].Add((*alptr)[ages[age][k]], *CI[i], preys[i]->getUseRatio(areas[area][j]));
-            }
-          }
-        }
-      }
-    }
-  }
+  for (g = 0; g < plan.numGroups(); g++)
+    if (preys[groupprey[g]]->isPreyArea(grouparea[g]))
+      plan.Sum(g, preys[groupprey[g]]->getUseRatio(grouparea[g]), 1.0);
 }
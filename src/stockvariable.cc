@@ -1,19 +1,17 @@
 #include "stockvariable.h"
 #include "errorhandler.h"
-#include "ecosystem.h"
+#include "stock.h"
 #include "readword.h"
 #include "gadget.h"
 #include "global.h"
 
-extern Ecosystem* EcoSystem;
-
-
-void StockVariable::read(CommentStream& infile) {
+void StockVariable::read(CommentStream& infile, const Keeper* const keeper) {
 
   int i;
   char text[MaxStrLength];
   strncpy(text, "", MaxStrLength);
 
+  allstocks = keeper->getModelStocks();
   infile >> ws;
   char c = infile.peek();
   biomass = 1;
@@ -47,13 +45,13 @@ void StockVariable::Update() {
   //JMB need to find the stocks - only need to do this once
   if (stocks.Size() == 0) {
 
-    StockPtrVector stockvec;
-    stockvec = EcoSystem->getModelStockVector();
+    if (allstocks == 0)
+      handle.logMessage(LOGFAIL, "Error in stockvariable - no stocks found for the current model");
 
-    for (i = 0; i < stockvec.Size(); i++)
+    for (i = 0; i < allstocks->Size(); i++)
       for (j = 0; j < stocknames.Size(); j++)
-        if (strcasecmp(stockvec[i]->getName(), stocknames[j]) == 0)
-          stocks.resize(stockvec[i]);
+        if (strcasecmp((*allstocks)[i]->getName(), stocknames[j]) == 0)
+          stocks.resize((*allstocks)[i]);
 
     if (stocks.Size() != stocknames.Size()) {
       handle.logMessage(LOGWARN, "Error in stockvariable - failed to match stocks");
@@ -84,5 +82,6 @@ void StockVariable::Interchange(StockVariable& newSV) const {
   newSV.value = value;
   newSV.biomass = biomass;
   newSV.stocks = stocks;
+  newSV.allstocks = allstocks;
   newSV.stocknames = stocknames;
 }
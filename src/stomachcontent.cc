@@ -62,6 +62,10 @@ void StomachContent::addLikelihood(const TimeClass* const TimeInfo) {
   likelihood += StomCont->calcLikelihood(TimeInfo);
 }
 
+int StomachContent::isIncreasing() const {
+  return (strcasecmp(functionname, "scnumbers") != 0);
+}
+
 void StomachContent::Reset(const Keeper* const keeper) {
   Likelihood::Reset(keeper);
   if (isZero(weight))
@@ -500,6 +504,7 @@ SCNumbers::SCNumbers(CommentStream& infile, const AreaClass* const Area,
   const char* datafilename, const char* givenname)
   : SC(infile, Area, TimeInfo, keeper, datafilename, givenname) {
 
+  int i, a, pred, prey, numprey;
   ifstream datafile;
   CommentStream subdata(datafile);
   //read in stomach content from file
@@ -515,6 +520,19 @@ SCNumbers::SCNumbers(CommentStream& infile, const AreaClass* const Area,
   MN.setValue(epsilon);
   mndist.resize(likelihoodValues.Nrow(), 0.0);
   mndata.resize(likelihoodValues.Nrow(), 0.0);
+
+  //the observed data doesn't change, so the terms that only depend on it are calculated once
+  for (i = 0; i < obsConsumption.Nrow(); i++) {
+    numprey = (areas.Nrow() > 0 ? obsConsumption[i][0]->Ncol(0) : 0);
+    dataterms.AddRows(1, areas.Nrow() * numprey, 0.0);
+    for (a = 0; a < areas.Nrow(); a++) {
+      for (prey = 0; prey < numprey; prey++) {
+        for (pred = 0; pred < mndata.Size(); pred++)
+          mndata[pred] = (*obsConsumption[i][a])[pred][prey];
+        dataterms[i][a * numprey + prey] = MN.calcDataTerm(mndata);
+      }
+    }
+  }
 }
 
 void SCNumbers::readStomachNumberContent(CommentStream& infile, const TimeClass* const TimeInfo) {
@@ -621,16 +639,17 @@ void SCNumbers::readStomachNumberContent(CommentStream& infile, const TimeClass*
 }
 
 double SCNumbers::calcLikelihood() {
-  int a, pred, prey;
+  int a, pred, prey, numprey;
   MN.Reset();
   for (a = 0; a < areas.Nrow(); a++) {
     likelihoodValues[timeindex][a] = 0.0;
-    for (prey = 0; prey < obsConsumption[timeindex][a]->Ncol(0); prey++) {
+    numprey = obsConsumption[timeindex][a]->Ncol(0);
+    for (prey = 0; prey < numprey; prey++) {
       for (pred = 0; pred < mndata.Size(); pred++) {
         mndata[pred] = (*obsConsumption[timeindex][a])[pred][prey];
         mndist[pred] = (*modelConsumption[timeindex][a])[pred][prey];
       }
-      likelihoodValues[timeindex][a] += MN.calcLogLikelihood(mndata, mndist);
+      likelihoodValues[timeindex][a] += MN.calcLogLikelihood(mndata, mndist, dataterms[timeindex][a * numprey + prey]);
     }
   }
   return MN.getLogLikelihood();
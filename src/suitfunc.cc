@@ -1,5 +1,6 @@
 #include "suitfunc.h"
 #include "errorhandler.h"
+#include "mathfunc.h"
 #include "gadget.h"
 #include "global.h"
 
@@ -11,6 +12,7 @@ void SuitFunc::readConstants(CommentStream& infile,
 
   coeff.read(infile, TimeInfo, keeper);
   coeff.Update(TimeInfo);
+  keeper->addNaNFlag(&nanflag);
 }
 
 void SuitFunc::setPredLength(double length) {
@@ -33,6 +35,17 @@ int SuitFunc::didChange(const TimeClass* const TimeInfo) {
   return coeff.didChange(TimeInfo);
 }
 
+void SuitFunc::calculateVector(double predlength, const LengthGroupDivision* const LgrpDiv, DoubleVector& result) {
+  int j;
+  for (j = 0; j < result.Size(); j++) {
+    if (this->usesPreyLength())
+      this->setPreyLength(LgrpDiv->meanLength(j));
+    if (this->usesPredLength())
+      this->setPredLength(predlength);
+    result[j] = this->calculate();
+  }
+}
+
 // ********************************************************
 // Functions for ExpSuitFuncA suitability function
 // ********************************************************
@@ -42,17 +55,30 @@ ExpSuitFuncA::ExpSuitFuncA() : SuitFunc("ExponentialSuitFunc") {
   predLength = -1.0;
 }
 
-double ExpSuitFuncA::calculate() {
-  double check = 0.0;
-
+double ExpSuitFuncA::calcExponent(double preylength, double predlength) {
   if (coeff[0] < 0.0 && coeff[1] < 0.0)
-    check = coeff[3] / (1.0 + exp(-(coeff[0] - (coeff[1] * preyLength) + (coeff[2] * predLength))));
+    return -(coeff[0] - (coeff[1] * preylength) + (coeff[2] * predlength));
   else if (coeff[0] > 0.0 && coeff[1] > 0.0)
-    check = coeff[3] / (1.0 + exp(-(-coeff[0] + (coeff[1] * preyLength) + (coeff[2] * predLength))));
-  else
-    check = coeff[3] / (1.0 + exp(-(coeff[0] + (coeff[1] * preyLength) + (coeff[2] * predLength))));
+    return -(-coeff[0] + (coeff[1] * preylength) + (coeff[2] * predlength));
+  return -(coeff[0] + (coeff[1] * preylength) + (coeff[2] * predlength));
+}
 
+double ExpSuitFuncA::calculate() {
+  return this->checkSuitability(coeff[3] / (1.0 + exp(this->calcExponent(preyLength, predLength))));
+}
+
+void ExpSuitFuncA::calculateVector(double predlength, const LengthGroupDivision* const LgrpDiv, DoubleVector& result) {
+  int j;
+  for (j = 0; j < result.Size(); j++)
+    result[j] = this->calcExponent(LgrpDiv->meanLength(j), predlength);
+  calcExpVector(&result[0], &result[0], result.Size());
+  for (j = 0; j < result.Size(); j++)
+    result[j] = this->checkSuitability(coeff[3] / (1.0 + result[j]));
+}
+
+double ExpSuitFuncA::checkSuitability(double check) {
   if (check != check) { //check for NaN
+    nanflag = 1;
     handle.logMessageNaN(LOGWARN, "exponential suitability function");
     return 0.0;
   }
@@ -131,9 +157,21 @@ ExpSuitFuncL50::ExpSuitFuncL50() : SuitFunc("ExponentialL50SuitFunc") {
 }
 
 double ExpSuitFuncL50::calculate() {
-  double check = 1.0 / (1.0 + exp(-1.0 * coeff[0] * (preyLength - coeff[1])));
+  return this->checkSuitability(1.0 / (1.0 + exp(-1.0 * coeff[0] * (preyLength - coeff[1]))));
+}
+
+void ExpSuitFuncL50::calculateVector(double predlength, const LengthGroupDivision* const LgrpDiv, DoubleVector& result) {
+  int j;
+  for (j = 0; j < result.Size(); j++)
+    result[j] = -1.0 * coeff[0] * (LgrpDiv->meanLength(j) - coeff[1]);
+  calcExpVector(&result[0], &result[0], result.Size());
+  for (j = 0; j < result.Size(); j++)
+    result[j] = this->checkSuitability(1.0 / (1.0 + result[j]));
+}
 
+double ExpSuitFuncL50::checkSuitability(double check) {
   if (check != check) { //check for NaN
+    nanflag = 1;
     handle.logMessageNaN(LOGWARN, "exponential l50 suitability function");
     return 0.0;
   }
@@ -180,6 +218,7 @@ double InverseSuitFunc::calculate() {
   double check = 1.0 / (1.0 + exp(-1.0 * coeff[0] * (preyLength - coeff[1])));
 
   if (check != check) { //check for NaN
+    nanflag = 1;
     handle.logMessageNaN(LOGWARN, "inverse suitability function");
     return 0.0;
   }
@@ -239,6 +278,7 @@ double RichardsSuitFunc::calculate() {
     check = pow(coeff[3] / (1.0 + exp(-(coeff[0] + coeff[1] * preyLength + coeff[2] * predLength))), (1.0 / coeff[4]));
 
   if (check != check) { //check for NaN
+    nanflag = 1;
     handle.logMessageNaN(LOGWARN, "richards suitability function");
     return 0.0;
   }
@@ -272,6 +312,7 @@ double GammaSuitFunc::calculate() {
   check *= pow(preyLength / ((coeff[0] - 1.0) * coeff[1] * coeff[2]), (coeff[0] - 1.0));
 
   if (check != check) { //check for NaN
+    nanflag = 1;
     handle.logMessageNaN(LOGWARN, "gamma suitability function");
     return 0.0;
   }
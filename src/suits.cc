@@ -35,29 +35,37 @@ void Suits::Initialise(const Predator* const pred) {
 }
 
 void Suits::Reset(const Predator* const pred, const TimeClass* const TimeInfo) {
-  int i, j, p;
+  int i, p, check;
+
+  //the values from the first timestep of the last model run can be used if the parameters havent changed
+  //they are calculated again if a NaN was found, so that the NaN is recorded for this model run
+  check = 1;
+  if (TimeInfo->getTime() == 1) {
+    check = (parchanged || nanfound || calctime != 1);
+    parchanged = 0;
+    nanfound = 0;
+  }
 
   for (p = 0; p < preynames.Size(); p++) {
     suitFunction[p]->updateConstants(TimeInfo);
-    if (suitFunction[p]->didChange(TimeInfo)) {
-      for (i = 0; i < preCalcSuitability[p]->Nrow(); i++) {
-        for (j = 0; j < preCalcSuitability[p]->Ncol(i); j++) {
-          if (suitFunction[p]->usesPreyLength())
-            suitFunction[p]->setPreyLength(pred->getPrey(p)->getLengthGroupDiv()->meanLength(j));
-
-          if (suitFunction[p]->usesPredLength())
-            suitFunction[p]->setPredLength(pred->getLengthGroupDiv()->meanLength(i));
-
-          (*preCalcSuitability[p])[i][j] = suitFunction[p]->calculate();
-        }
-      }
+    //the values based on the stock data can change even if the parameters havent
+    if ((check || suitFunction[p]->usesStockData()) && (suitFunction[p]->didChange(TimeInfo))) {
+      calctime = TimeInfo->getTime();
+      numcalc++;
+      for (i = 0; i < preCalcSuitability[p]->Nrow(); i++)
+        suitFunction[p]->calculateVector(pred->getLengthGroupDiv()->meanLength(i),
+          pred->getPrey(p)->getLengthGroupDiv(), (*preCalcSuitability[p])[i]);
+      if ((calctime == 1) && (suitFunction[p]->getNaNFlag()))
+        nanfound = 1;
     }
   }
 
   #ifdef SUIT_SCALE
   //Scaling of suitabilities, so that in each lengthgroup of each predator, the
   //maximum suitability is exactly 1, if any suitability is different from 0.
+  int j;
   double mult;
+  numcalc++;
   for (i = 0; i < pred->getLengthGroupDiv()->numLengthGroups(); i++) {
     mult = 0.0;
     for (p = 0; p < preynames.Size(); p++)
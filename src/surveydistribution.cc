@@ -262,6 +262,13 @@ void SurveyDistribution::readDistributionData(CommentStream& infile,
   if (count == 0)
     handle.logMessage(LOGWARN, "Warning in surveydistribution - found no data in the data file for", this->getName());
 
+  obsTotal.AddRows(obsDistribution.Nrow(), numarea, 0.0);
+  for (timeid = 0; timeid < obsDistribution.Nrow(); timeid++)
+    for (areaid = 0; areaid < numarea; areaid++)
+      for (ageid = 0; ageid < (*obsDistribution[timeid][areaid]).Nrow(); ageid++)
+        for (lenid = 0; lenid < (*obsDistribution[timeid][areaid]).Ncol(ageid); lenid++)
+          obsTotal[timeid][areaid] += (*obsDistribution[timeid][areaid])[ageid][lenid];
+
   if (Steps.Size() > 0) {
     //JMB - to be comparable, this should only take place on the same step in each year
     step = Steps[0];
@@ -529,13 +536,12 @@ double SurveyDistribution::calcLikMultinomial() {
   total = 0.0;
   for (area = 0; area < areas.Nrow(); area++) {
     temp = 0.0;
-    obstotal = 0.0;
+    obstotal = obsTotal[timeindex][area];
     modtotal = 0.0;
     for (age = 0; age < (*obsDistribution[timeindex][area]).Nrow(); age++) {
       for (len = 0; len < (*obsDistribution[timeindex][area]).Ncol(age); len++) {
         temp -= (*obsDistribution[timeindex][area])[age][len] *
                  log(((*modelDistribution[timeindex][area])[age][len]) + epsilon);
-        obstotal += (*obsDistribution[timeindex][area])[age][len];
         modtotal += ((*modelDistribution[timeindex][area])[age][len] + epsilon);
       }
     }
@@ -605,14 +611,11 @@ double SurveyDistribution::calcLikLog() {
 
   total = 0.0;
   for (area = 0; area < areas.Nrow(); area++) {
-    obstotal = 0.0;
+    obstotal = obsTotal[timeindex][area];
     modtotal = 0.0;
-    for (age = 0; age < (*obsDistribution[timeindex][area]).Nrow(); age++) {
-      for (len = 0; len < (*obsDistribution[timeindex][area]).Ncol(age); len++) {
+    for (age = 0; age < (*obsDistribution[timeindex][area]).Nrow(); age++)
+      for (len = 0; len < (*obsDistribution[timeindex][area]).Ncol(age); len++)
         modtotal += (*modelDistribution[timeindex][area])[age][len];
-        obstotal += (*obsDistribution[timeindex][area])[age][len];
-      }
-    }
 
     if (!(isZero(modtotal)))
       likelihoodValues[timeindex][area] = (log(obstotal / modtotal) * log(obstotal / modtotal));
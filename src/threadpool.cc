@@ -0,0 +1,113 @@
+#include "threadpool.h"
+#include "errorhandler.h"
+#include "gadget.h"
+#include "global.h"
+
+ThreadPool::ThreadPool() {
+  numthreads = 1;
+#ifdef GADGET_THREADS
+  threads = 0;
+  taskfunc = 0;
+  taskdata = 0;
+  numtasks = 0;
+  nexttask = 0;
+  numdone = 0;
+  generation = 0;
+  stopping = 0;
+  pthread_mutex_init(&mutex, NULL);
+  pthread_cond_init(&taskready, NULL);
+  pthread_cond_init(&taskdone, NULL);
+#endif
+}
+
+ThreadPool::~ThreadPool() {
+#ifdef GADGET_THREADS
+  int i;
+  if (numthreads > 1) {
+    pthread_mutex_lock(&mutex);
+    stopping = 1;
+    pthread_cond_broadcast(&taskready);
+    pthread_mutex_unlock(&mutex);
+    for (i = 1; i < numthreads; i++)
+      pthread_join(threads[i - 1], NULL);
+    delete[] threads;
+  }
+  pthread_cond_destroy(&taskdone);
+  pthread_cond_destroy(&taskready);
+  pthread_mutex_destroy(&mutex);
+#endif
+}
+
+void ThreadPool::startThreads(int num) {
+  if ((numthreads > 1) || (num < 2))
+    return;
+
+#ifdef GADGET_THREADS
+  int i;
+  threads = new pthread_t[num - 1];
+  for (i = 1; i < num; i++) {
+    if (pthread_create(&threads[i - 1], NULL, ThreadPool::runThread, this) != 0)
+      handle.logMessage(LOGFAIL, "Error in threadpool - failed to create thread", i);
+    numthreads++;
+  }
+#endif
+}
+
+void ThreadPool::Run(ThreadTask func, void* data, int num) {
+  int i;
+  if ((numthreads < 2) || (num < 2)) {
+    for (i = 0; i < num; i++)
+      func(data, i);
+    return;
+  }
+
+#ifdef GADGET_THREADS
+  pthread_mutex_lock(&mutex);
+  taskfunc = func;
+  taskdata = data;
+  numtasks = num;
+  nexttask = 0;
+  numdone = 0;
+  generation++;
+  pthread_cond_broadcast(&taskready);
+
+  //the calling thread also runs tasks until there are none left to start
+  this->runTasks();
+  while (numdone < numtasks)
+    pthread_cond_wait(&taskdone, &mutex);
+  pthread_mutex_unlock(&mutex);
+#endif
+}
+
+#ifdef GADGET_THREADS
+void ThreadPool::runTasks() {
+  int task;
+  while (nexttask < numtasks) {
+    task = nexttask;
+    nexttask++;
+    pthread_mutex_unlock(&mutex);
+    taskfunc(taskdata, task);
+    pthread_mutex_lock(&mutex);
+    numdone++;
+    if (numdone == numtasks)
+      pthread_cond_signal(&taskdone);
+  }
+}
+
+void* ThreadPool::runThread(void* pool) {
+  ThreadPool* tp = (ThreadPool*)pool;
+  int seen = 0;  //the threads are started before any tasks are given to the pool
+
+  pthread_mutex_lock(&tp->mutex);
+  while (1) {
+    while ((tp->generation == seen) && (!tp->stopping))
+      pthread_cond_wait(&tp->taskready, &tp->mutex);
+    if (tp->stopping)
+      break;
+    seen = tp->generation;
+    tp->runTasks();
+  }
+  pthread_mutex_unlock(&tp->mutex);
+  return NULL;
+}
+#endif
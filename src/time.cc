@@ -90,6 +90,13 @@ int TimeClass::didStepSizeChange() const {
   return (timesteps[currentstep] != timesteps[currentstep - 1]);
 }
 
+int TimeClass::maxSubSteps() const {
+  int i, maxsub = 0;
+  for (i = 0; i < numsubsteps.Size(); i++)
+    maxsub = max(maxsub, numsubsteps[i]);
+  return maxsub;
+}
+
 void TimeClass::Reset() {
   currentyear = firstyear;
   currentstep = firststep;